@@ -50,7 +50,8 @@ _aff3ct() {
 		      --mod-ups --mod-cpm-ws --mod-cpm-map --mod-cpm-L --mod-cpm-p    \
 		      --mod-cpm-k --mod-cpm-std --mod-const-path --dmod-max --dmod-psi\
 		      --dmod-ite                                                      \
-		      --dmod-no-sig2 --chn-type --chn-path --chn-blk-fad --qnt-type   \
+		      --dmod-no-sig2 --chn-type --chn-path --chn-blk-fad --chn-doppler\
+		      --chn-sin --chn-prob --qnt-type                                 \
 		      --qnt-dec --qnt-bits --qnt-range --dec-type --dec-implem        \
 		      --term-no --term-freq --sim-seed --sim-mpi-comm --sim-pyber     \
 		      --sim-no-colors --mnt-err-trk --mnt-err-trk-rev                 \
@@ -170,7 +171,16 @@ _aff3ct() {
 	      ${codetype} == "LDPC"       && ${simutype} == "BFERI" ]]
 	then
 		opts="$opts --dec-type -D --dec-implem --dec-ite -i --cde-alist-path \
-		--dec-no-synd --dec-off --dec-norm --dec-synd-depth --dec-simd"
+		--dec-no-synd --dec-off --dec-norm --dec-synd-depth --dec-simd     \
+		--dec-reorder --dec-msg-bits --dec-app-bits --dec-group-size       \
+		--dec-compress --dec-threads --cde-bin-path                        \
+		--enc-cache-path"
+	fi
+
+	# add contents of Launcher_BFER_LDPC.cpp (streaming decoding, standard BFER only)
+	if [[ ${codetype} == "LDPC"       && ${simutype} == "BFER" ]]
+	then
+		opts="$opts --dec-stream"
 	fi
 
 	# add contents of Launcher_BFER_uncoded.cpp
@@ -205,7 +215,9 @@ _aff3ct() {
 		--sim-ite | --cde-sigma | --dec-snr | --dec-ite |-i | --dec-lists |  \
 		-L | --sim-json-path | --dec-off | --dec-norm | --term-freq |        \
 		--sim-seed | --sim-mpi-comm | --sim-pyber | --dec-polar-nodes |      \
+		--chn-doppler | --chn-sin | --chn-prob |                             \
 		--itl-cols | --dec-synd-depth | --pct-pattern |                      \
+		--dec-msg-bits | --dec-app-bits | --dec-group-size | --dec-threads | \
 		--dec-fnc-q | --dec-fnc-ite-m | --dec-fnc-ite-M | --dec-fnc-ite-s    )
 			COMPREPLY=()
 			;;
@@ -261,7 +273,7 @@ _aff3ct() {
 				RA)         params="AZCW COSET USER RA"                     ;;
 				BCH)        params="AZCW COSET USER BCH"                    ;;
 				TURBO)      params="AZCW COSET USER TURBO"                  ;;
-				LDPC)       params="AZCW COSET USER LDPC LDPC_H LDPC_DVBS2" ;;
+				LDPC)       params="AZCW COSET USER LDPC LDPC_H LDPC_RU LDPC_DVBS2" ;;
 			esac
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
@@ -275,7 +287,7 @@ _aff3ct() {
 				RA)         params="STD"                      ;;
                 BCH)        params="ALGEBRAIC"                ;;
 				TURBO)      params="LTE CCSDS"                ;;
-				LDPC)       params="BP BP_FLOODING BP_LAYERED";;
+				LDPC)       params="BP BP_FLOODING BP_LAYERED BP_SHUFFLED BP_RESIDUAL";;
 			esac
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
@@ -295,7 +307,7 @@ _aff3ct() {
 
 		--cde-awgn-fb-path | --dec-gen-path | --sim-pb-path | --itl-path | \
 		--mod-const-path | --src-path | --enc-path | --chn-path |          \
-		--cde-alist-path | --mnt-err-trk-path) 
+		--cde-alist-path | --mnt-err-trk-path | --enc-cache-path | --cde-bin-path) 
 			_filedir
 			;;
 		
@@ -315,7 +327,7 @@ _aff3ct() {
 
 		--chn-type)
 			local params="NO AWGN AWGN_FAST AWGN_GSL AWGN_MKL RAYLEIGH RAYLEIGH_FAST RAYLEIGH_GSL RAYLEIGH_MKL \
-			              USER"
+			              RAYLEIGH_JAKES RAYLEIGH_JAKES_FAST BSC BEC USER"
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
 
@@ -336,7 +348,7 @@ _aff3ct() {
 			              14-DARC 15-CAN 15-MPT1327 16-CHAKRAVARTY 16-ARINC 16-CDMA2000         \
 			              16-DECT 16-T10-DIF 16-DNP 16-OPENSAFETY-A 16-OPENSAFETY-B 16-PROFIBUS \
 			              16-CCITT 16-IBM 17-CAN 21-CAN 24-FLEXRAY 24-RADIX-64 24-LTEA 30-CDMA  \
-			              32-KOOPMAN 32-AIXM 32-CASTAGNOLI 32-GZIP"
+			              32-KOOPMAN 32-AIXM 32-CASTAGNOLI 32-GZIP 40-GSM 64-ISO 64-ECMA"
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
 
@@ -7,6 +7,7 @@
 #else
 #include "Simulation/BFER/Standard/Threads/Simulation_BFER_std_threads.hpp"
 #endif
+#include "Tools/Exception/exception.hpp"
 #include "Tools/Codec/LDPC/Codec_LDPC.hpp"
 
 #include "Launcher_BFER_LDPC.hpp"
@@ -22,6 +23,7 @@ Launcher_BFER_LDPC<B,R,Q>
 {
 	this->params.code     .type             = "LDPC";
 	this->params.encoder  .type             = "AZCW";
+	this->params.encoder  .cache_path       = ".";
 	this->params.encoder  .systematic       = true;
 	this->params.quantizer.n_bits           = 6;
 	this->params.quantizer.n_decimals       = 2;
@@ -31,7 +33,13 @@ Launcher_BFER_LDPC<B,R,Q>
 	this->params.decoder  .offset           = 0.f;
 	this->params.decoder  .normalize_factor = 1.f;
 	this->params.decoder  .enable_syndrome  = true;
+	this->params.decoder  .reorder          = false;
 	this->params.decoder  .syndrome_depth   = 2;
+	this->params.decoder  .n_bits_msg       = 0;
+	this->params.decoder  .n_bits_app       = 0;
+	this->params.decoder  .group_size       = 1;
+	this->params.decoder  .compress         = false;
+	this->params.decoder  .n_threads        = 1;
 }
 
 template <typename B, typename R, typename Q>
@@ -43,13 +51,28 @@ void Launcher_BFER_LDPC<B,R,Q>
 	// ---------------------------------------------------------------------------------------------------------- code
 	this->req_args[{"cde-alist-path"}] =
 		{"string",
-		 "path to the AList formated file."};
+		 "path to the H matrix, AList formated file, base matrix of a quasi-cyclic code (\"QC n_block_rows "
+		 "n_block_cols Z\" then one line of shifts per block row, -1 for the zero blocks) or binary file (detected "
+		 "automatically, see \"--cde-bin-path\")."};
+	this->opt_args[{"cde-bin-path"}] =
+		{"string",
+		 "path of a binary file in which the H matrix and the information bits positions are written (conversion of the "
+		 "\"--cde-alist-path\" file, faster to load in the next runs)."};
 
 	// ------------------------------------------------------------------------------------------------------- encoder
-	this->opt_args[{"enc-type"}][2] += ", LDPC, LDPC_H, LDPC_DVBS2";
+	this->opt_args[{"enc-type"}][2] += ", LDPC, LDPC_H, LDPC_RU, LDPC_DVBS2";
+	this->opt_args[{"enc-path"}][1] += " With \"--enc-type LDPC\": the G matrix (AList format), with \"--enc-type "
+	                                   "LDPC_DVBS2\": the table of addresses of the parity bit accumulators, one line "
+	                                   "per group of 360 information bits (optional for the standard formats already "
+	                                   "known).";
+	this->opt_args[{"enc-cache-path"}] =
+		{"string",
+		 "directory where the G matrices derived from H are cached (works only with \"--enc-type LDPC_H\" and "
+		 "\"--enc-type LDPC_RU\", default is the working directory, nothing is cached when the directory is not "
+		 "writable)."};
 
 	// ------------------------------------------------------------------------------------------------------- decoder
-	this->opt_args[{"dec-type", "D"}].push_back("BP, BP_FLOODING, BP_LAYERED");
+	this->opt_args[{"dec-type", "D"}].push_back("BP, BP_FLOODING, BP_LAYERED, BP_SHUFFLED, BP_RESIDUAL");
 	this->opt_args[{"dec-implem"   }].push_back("ONMS, SPA, LSPA, GALA");
 	this->opt_args[{"dec-ite", "i"}] =
 		{"positive_int",
@@ -66,10 +89,42 @@ void Launcher_BFER_LDPC<B,R,Q>
 	this->opt_args[{"dec-synd-depth"}] =
 		{"positive_int",
 		 "successive number of iterations to validate the syndrome detection."};
+	this->opt_args[{"dec-reorder"}] =
+		{"",
+		 "reorder the variable nodes (reverse Cuthill-McKee) to improve the memory locality of the layered decoders."};
+	this->opt_args[{"dec-msg-bits"}] =
+		{"positive_int",
+		 "number of bits of the check nodes to variable nodes messages, saturated in fixed-point (works only with "
+		 "\"--dec-type BP_LAYERED --dec-implem ONMS --dec-simd INTER\", default is the number of bits of the a "
+		 "posteriori values minus 2)."};
+	this->opt_args[{"dec-app-bits"}] =
+		{"positive_int",
+		 "number of bits of the a posteriori values, saturated in fixed-point (works only with \"--dec-type "
+		 "BP_LAYERED --dec-implem ONMS --dec-simd INTER\", default is the number of bits of the decoder type)."};
+	this->opt_args[{"dec-group-size"}] =
+		{"positive_int",
+		 "number of variable nodes updated together in the column-layered BP (works only with \"--dec-type "
+		 "BP_SHUFFLED\", N gives the flooding schedule). The variable nodes of a group, then the check nodes "
+		 "connected to the group, are shared between the threads of \"--dec-threads\"."};
+	this->opt_args[{"dec-compress"}] =
+		{"",
+		 "store the check nodes to variable nodes messages compressed (two magnitudes, an index and the signs per "
+		 "check node) to reduce the memory footprint (works only with \"--dec-type BP_LAYERED --dec-implem ONMS "
+		 "--dec-simd INTER\")."};
+	this->opt_args[{"dec-threads"}] =
+		{"positive_int",
+		 "number of threads decoding the same frame, the check nodes of each layer (or the variable nodes of each "
+		 "group) are shared between the threads (works only with \"--dec-type BP_LAYERED --dec-implem ONMS "
+		 "--dec-simd INTRA\" and \"--dec-type BP_SHUFFLED\")."};
+	this->opt_args[{"dec-stream"}] =
+		{"",
+		 "decode a stream of frames: each SIMD lane is refilled with a new frame as soon as its frame is decoded "
+		 "instead of waiting for the whole wave of frames (works only with \"--dec-type BP_LAYERED --dec-implem ONMS "
+		 "--dec-simd INTER\")."};
 	this->opt_args[{"dec-simd"}] =
 		{"string",
 		 "the SIMD strategy you want to use.",
-		 "INTER"};
+		 "INTER, INTRA"};
 }
 
 template <typename B, typename R, typename Q>
@@ -80,6 +135,10 @@ void Launcher_BFER_LDPC<B,R,Q>
 
 	// ---------------------------------------------------------------------------------------------------------- code
 	if(this->ar.exist_arg({"cde-alist-path"})) this->params.code.alist_path = this->ar.get_arg({"cde-alist-path"});
+	if(this->ar.exist_arg({"cde-bin-path"  })) this->params.code.bin_path   = this->ar.get_arg({"cde-bin-path"  });
+
+	// ------------------------------------------------------------------------------------------------------- encoder
+	if(this->ar.exist_arg({"enc-cache-path"})) this->params.encoder.cache_path = this->ar.get_arg({"enc-cache-path"});
 
 	// ------------------------------------------------------------------------------------------------------- decoder
 	if(this->ar.exist_arg({"dec-ite",   "i"})) this->params.decoder.n_ite            = this->ar.get_arg_int  ({"dec-ite", "i"  });
@@ -87,8 +146,21 @@ void Launcher_BFER_LDPC<B,R,Q>
 	if(this->ar.exist_arg({"dec-norm"      })) this->params.decoder.normalize_factor = this->ar.get_arg_float({"dec-norm"      });
 	if(this->ar.exist_arg({"dec-synd-depth"})) this->params.decoder.syndrome_depth   = this->ar.get_arg_int  ({"dec-synd-depth"});
 	if(this->ar.exist_arg({"dec-no-synd"   })) this->params.decoder.enable_syndrome  = false;
+	if(this->ar.exist_arg({"dec-reorder"   })) this->params.decoder.reorder          = true;
+	if(this->ar.exist_arg({"dec-msg-bits"  })) this->params.decoder.n_bits_msg       = this->ar.get_arg_int  ({"dec-msg-bits"  });
+	if(this->ar.exist_arg({"dec-app-bits"  })) this->params.decoder.n_bits_app       = this->ar.get_arg_int  ({"dec-app-bits"  });
+	if(this->ar.exist_arg({"dec-group-size"})) this->params.decoder.group_size       = this->ar.get_arg_int  ({"dec-group-size"});
+	if(this->ar.exist_arg({"dec-compress"  })) this->params.decoder.compress         = true;
+	if(this->ar.exist_arg({"dec-threads"   })) this->params.decoder.n_threads        = this->ar.get_arg_int  ({"dec-threads"   });
+	if(this->ar.exist_arg({"dec-stream"    })) this->params.decoder.stream           = true;
 	if(this->ar.exist_arg({"dec-simd"      })) this->params.decoder.simd_strategy    = this->ar.get_arg      ({"dec-simd"      });
 
+	if (this->params.decoder.stream && (this->params.decoder.type   != "BP_LAYERED" ||
+	                                    this->params.decoder.implem != "ONMS"       ||
+	                                    this->params.decoder.simd_strategy != "INTER"))
+		throw invalid_argument(__FILE__, __LINE__, __func__, "The streaming decoding (\"--dec-stream\") works only "
+		                       "with \"--dec-type BP_LAYERED --dec-implem ONMS --dec-simd INTER\".");
+
 	if (this->params.decoder.simd_strategy == "INTER" && !this->ar.exist_arg({"sim-inter-lvl"}))
 		this->params.simulation.inter_frame_level = mipp::nElReg<Q>();
 }
@@ -114,6 +186,8 @@ std::vector<std::pair<std::string,std::string>> Launcher_BFER_LDPC<B,R,Q>
 	auto p = Launcher_BFER<B,R,Q>::header_code();
 
 	p.push_back(std::make_pair("AList file path", this->params.code.alist_path));
+	if (!this->params.code.bin_path.empty())
+		p.push_back(std::make_pair("Binary file path", this->params.code.bin_path));
 
 	return p;
 }
@@ -140,6 +214,26 @@ std::vector<std::pair<std::string,std::string>> Launcher_BFER_LDPC<B,R,Q>
 	if (this->params.decoder.enable_syndrome)
 		p.push_back(std::make_pair("Stop criterion depth",  std::to_string(this->params.decoder.syndrome_depth)));
 
+	if (this->params.decoder.type == "BP_LAYERED")
+		p.push_back(std::make_pair("Reordering (RCM)", this->params.decoder.reorder ? "on" : "off"));
+
+	if (this->params.decoder.type == "BP_SHUFFLED")
+		p.push_back(std::make_pair("Group size", std::to_string(this->params.decoder.group_size)));
+
+	if (this->params.decoder.compress)
+		p.push_back(std::make_pair("Compressed messages", "on"));
+
+	if (this->params.decoder.stream)
+		p.push_back(std::make_pair("Streaming (lanes refill)", "on"));
+
+	if (this->params.decoder.n_threads > 1)
+		p.push_back(std::make_pair("Num. of threads per frame", std::to_string(this->params.decoder.n_threads)));
+
+	if (this->params.decoder.n_bits_msg)
+		p.push_back(std::make_pair("Messages bits", std::to_string(this->params.decoder.n_bits_msg)));
+	if (this->params.decoder.n_bits_app)
+		p.push_back(std::make_pair("APP bits", std::to_string(this->params.decoder.n_bits_app)));
+
 	return p;
 }
 
@@ -149,8 +243,11 @@ std::vector<std::pair<std::string,std::string>> Launcher_BFER_LDPC<B,R,Q>
 {
 	auto p = Launcher_BFER<B,R,Q>::header_encoder();
 
-	if (this->params.encoder.type == "LDPC")
+	if (this->params.encoder.type == "LDPC" ||
+	   (this->params.encoder.type == "LDPC_DVBS2" && !this->params.encoder.path.empty()))
 		p.push_back(std::make_pair("Path", this->params.encoder.path));
+	if (this->params.encoder.type == "LDPC_H" || this->params.encoder.type == "LDPC_RU")
+		p.push_back(std::make_pair("Cache path", this->params.encoder.cache_path));
 
 	return p;
 }
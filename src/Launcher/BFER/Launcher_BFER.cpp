@@ -32,6 +32,7 @@ Launcher_BFER<B,R,Q>
 	this->params.monitor    .err_track_path   = "error_tracker";
 	this->params.encoder    .systematic       = true;
 	this->params.demodulator.max              = "MAX";
+	this->params.decoder    .stream           = false;
 	this->params.terminal   .type             = "STD";
 }
 
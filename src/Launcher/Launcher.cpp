@@ -13,6 +13,7 @@
 #include "Tools/date.h"
 #include "Tools/general_utils.h"
 #include "Tools/Factory/Factory_modem.hpp"
+#include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_Jakes.hpp"
 #include "Tools/Display/bash_tools.h"
 #include "Tools/Exception/exception.hpp"
 
@@ -86,6 +87,9 @@ Launcher<B,R,Q>
 	params.channel    .type              = "AWGN";
 	params.channel    .path              = "";
 	params.channel    .block_fading      = "NO";
+	params.channel    .doppler           = module::Channel_Rayleigh_LLR_Jakes<R>::default_doppler;
+	params.channel    .n_sin             = module::Channel_Rayleigh_LLR_Jakes<R>::default_n_sin;
+	params.channel    .probability       = -1.f;
 #ifdef MIPP_NO_INTRINSICS
 	params.quantizer  .type              = "STD";
 #else
@@ -240,7 +244,7 @@ void Launcher<B,R,Q>
 		 "select the number of iteration in the demodulator."};
 
 	// ------------------------------------------------------------------------------------------------------- channel
-	std::string chan_avail = "NO, USER, AWGN, AWGN_FAST, RAYLEIGH, RAYLEIGH_FAST";
+	std::string chan_avail = "NO, USER, AWGN, AWGN_FAST, RAYLEIGH, RAYLEIGH_FAST, RAYLEIGH_JAKES, RAYLEIGH_JAKES_FAST, BSC, BEC";
 #ifdef CHANNEL_GSL
 	chan_avail += ", AWGN_GSL, RAYLEIGH_GSL";
 #endif 
@@ -259,6 +263,17 @@ void Launcher<B,R,Q>
 		{"string",
 		 "block fading policy.",
 		 "NO, FRAME, ONETAP"};
+	opt_args[{"chn-doppler"}] =
+		{"positive_float",
+		 "normalized Doppler frequency (f_d * T_s) of the time-correlated fading, to use with \"--chn-type RAYLEIGH_JAKES\"."};
+	opt_args[{"chn-sin"}] =
+		{"positive_int",
+		 "number of sinusoids used to generate the time-correlated fading, to use with \"--chn-type RAYLEIGH_JAKES\"."};
+	opt_args[{"chn-prob"}] =
+		{"positive_float",
+		 "fixed flip (\"--chn-type BSC\") or erasure (\"--chn-type BEC\") probability, by default the probability "
+		 "follows the SNR: it is the error probability of a BPSK hard decision on an AWGN channel, p = Q(1 / sigma) "
+		 "(the demodulator LLRs still use sigma)."};
 
 	// ----------------------------------------------------------------------------------------------------- quantizer
 	if ((typeid(Q) != typeid(float)) && (typeid(Q) != typeid(double)))
@@ -426,9 +441,12 @@ void Launcher<B,R,Q>
 	if(ar.exist_arg({"dmod-psi"    })) params.demodulator.psi     = ar.get_arg    ({"dmod-psi"});
 
 	// ------------------------------------------------------------------------------------------------------- channel
-	if(ar.exist_arg({"chn-type"   })) params.channel.type         = ar.get_arg({"chn-type"   });
-	if(ar.exist_arg({"chn-path"   })) params.channel.path         = ar.get_arg({"chn-path"   });
-	if(ar.exist_arg({"chn-blk-fad"})) params.channel.block_fading = ar.get_arg({"chn-blk-fad"});
+	if(ar.exist_arg({"chn-type"   })) params.channel.type         = ar.get_arg      ({"chn-type"   });
+	if(ar.exist_arg({"chn-path"   })) params.channel.path         = ar.get_arg      ({"chn-path"   });
+	if(ar.exist_arg({"chn-blk-fad"})) params.channel.block_fading = ar.get_arg      ({"chn-blk-fad"});
+	if(ar.exist_arg({"chn-doppler"})) params.channel.doppler      = ar.get_arg_float({"chn-doppler"});
+	if(ar.exist_arg({"chn-sin"    })) params.channel.n_sin        = ar.get_arg_int  ({"chn-sin"    });
+	if(ar.exist_arg({"chn-prob"   })) params.channel.probability  = ar.get_arg_float({"chn-prob"   });
 
 	// ----------------------------------------------------------------------------------------------------- quantizer
 	if ((typeid(Q) != typeid(float)) && (typeid(Q) != typeid(double)))
@@ -678,6 +696,16 @@ std::vector<std::pair<std::string,std::string>> Launcher<B,R,Q>
 	if (params.channel.type.find("RAYLEIGH") != std::string::npos)
 		p.push_back(std::make_pair("Block fading policy", params.channel.block_fading));
 
+	if (params.channel.type.find("RAYLEIGH_JAKES") != std::string::npos)
+	{
+		p.push_back(std::make_pair("Normalized Doppler",  std::to_string(params.channel.doppler)));
+		p.push_back(std::make_pair("Number of sinusoids", std::to_string(params.channel.n_sin  )));
+	}
+
+	if (params.channel.type == "BSC" || params.channel.type == "BEC")
+		p.push_back(std::make_pair("Event probability", params.channel.probability < 0.f ? "Q(1 / sigma)" :
+		                                                std::to_string(params.channel.probability)));
+
 	return p;
 }
 
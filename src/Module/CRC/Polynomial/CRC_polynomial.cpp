@@ -88,13 +88,13 @@ std::string CRC_polynomial<B>
 }
 
 template <typename B>
-unsigned CRC_polynomial<B>
+uint64_t CRC_polynomial<B>
 ::value(std::string poly_key)
 {
 	if (known_polynomials.find(poly_key) != known_polynomials.end())
 		return std::get<0>(known_polynomials.at(poly_key));
 	else if(poly_key.length() > 2 && poly_key[0] == '0' && poly_key[1] == 'x')
-		return (unsigned)std::stoul(poly_key, 0, 16);
+		return (uint64_t)std::stoull(poly_key, 0, 16);
 	else
 		return 0;
 }
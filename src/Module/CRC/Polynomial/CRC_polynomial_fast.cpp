@@ -12,12 +12,12 @@ using namespace aff3ct::tools;
 template <typename B>
 CRC_polynomial_fast<B>
 ::CRC_polynomial_fast(const int K, std::string poly_key, const int size, const int n_frames, const std::string name)
-: CRC_polynomial<B>(K, poly_key, size, n_frames, name), lut_crc32(256), polynomial_packed_rev(0)
+: CRC_polynomial<B>(K, poly_key, size, n_frames, name), lut_crc(8 * 256), polynomial_packed_rev(0)
 {
-	if (this->get_size() > 32)
+	if (this->get_size() > 64)
 	{
 		std::stringstream message;
-		message << "'get_size()' has to be equal or smaller than 32 ('get_size()' = " << this->get_size() << ").";
+		message << "'get_size()' has to be equal or smaller than 64 ('get_size()' = " << this->get_size() << ").";
 		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
@@ -32,11 +32,20 @@ CRC_polynomial_fast<B>
 	// precompute a lookup table pour the v3 implem. of the CRC
 	for (auto i = 0; i < 256; i++)
 	{
-		unsigned crc = i;
+		uint64_t crc = i;
 		for (unsigned int j = 0; j < 8; j++)
-			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
-		lut_crc32[i] = crc;
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
+		lut_crc[i] = crc;
 	}
+
+	// precompute the lookup tables for the slicing-by-8 (v4 implem.): the table 'j' gives the CRC of a byte followed
+	// by 'j' null bytes
+	for (auto j = 1; j < 8; j++)
+		for (auto i = 0; i < 256; i++)
+		{
+			const auto prev = lut_crc[(j -1) * 256 +i];
+			lut_crc[j * 256 +i] = (prev >> 8) ^ lut_crc[prev & 0xFF];
+		}
 }
 
 template <typename B>
@@ -50,7 +59,7 @@ void CRC_polynomial_fast<B>
 	Bit_packer<B>::pack(U_K1, this->buff_crc.data(), this->K);
 
 	const auto data = (unsigned char*)this->buff_crc.data();
-	const auto crc  = this->compute_crc_v3((void*)data, this->K);
+	const auto crc  = this->compute_crc_v4((void*)data, this->K);
 
 	std::copy(U_K1, U_K1 + this->K, U_K2);
 	for (auto i = 0; i < this->get_size(); i++)
@@ -78,26 +87,26 @@ bool CRC_polynomial_fast<B>
 
 	unsigned char* bytes = (unsigned char*)V_K;
 
-	unsigned crc_invalid = 0;
+	uint64_t crc_invalid = 0;
 
 	const auto data = bytes;
-	const auto crc  = this->compute_crc_v3((void*)data, this->K);
+	const auto crc  = this->compute_crc_v4((void*)data, this->K);
 
 	auto n_bits_crc = crc_size;
 	auto current = data + (this->K / 8);
 
-	unsigned crc_ref = 0;
+	uint64_t crc_ref = 0;
 	if (rest)
 	{
 		auto cur = *current++;
 		for (auto j = rest; j < 8 && n_bits_crc > 0; j++)
-			crc_ref |= ((cur >> j) & 1) << (crc_size - n_bits_crc--);
+			crc_ref |= (uint64_t)((cur >> j) & 1) << (crc_size - n_bits_crc--);
 	}
 	while (n_bits_crc)
 	{
 		auto cur = *current++;
 		for (auto j = 0; j < 8 && n_bits_crc > 0; j++)
-			crc_ref |= ((cur >> j) & 1) << (crc_size - n_bits_crc--);
+			crc_ref |= (uint64_t)((cur >> j) & 1) << (crc_size - n_bits_crc--);
 	}
 
 	crc_invalid |= crc ^ crc_ref;
@@ -107,14 +116,14 @@ bool CRC_polynomial_fast<B>
 
 // Source of inspiration: http://create.stephan-brumme.com/crc32/ (Fastest Bitwise CRC32)
 template <typename B>
-unsigned CRC_polynomial_fast<B>
+uint64_t CRC_polynomial_fast<B>
 ::compute_crc_v1(const void* data, const int n_bits)
 {
 #if __BYTE_ORDER != __LITTLE_ENDIAN
 	throw runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
 #endif
 
-	unsigned crc = 0;
+	uint64_t crc = 0;
 
 	auto current = (unsigned char*)data;
 	auto length = n_bits / 8;
@@ -123,7 +132,7 @@ unsigned CRC_polynomial_fast<B>
 		crc ^= *current++;
 		for (auto j = 0; j < 8; j++)
 //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
 	}
 
 	auto rest = n_bits % 8;
@@ -136,7 +145,7 @@ unsigned CRC_polynomial_fast<B>
 		crc ^= cur;
 		for (auto j = 0; j < rest; j++)
 //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
 	}
 
 	return crc;
@@ -144,14 +153,14 @@ unsigned CRC_polynomial_fast<B>
 
 // Source of inspiration: http://create.stephan-brumme.com/crc32/ (Fastest Bitwise CRC32)
 template <typename B>
-unsigned CRC_polynomial_fast<B>
+uint64_t CRC_polynomial_fast<B>
 ::compute_crc_v2(const void* data, const int n_bits)
 {
 #if __BYTE_ORDER != __LITTLE_ENDIAN
 	throw runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
 #endif
 
-	unsigned crc = 0;
+	uint64_t crc = 0;
 
 	auto current = (unsigned int*)data;
 	auto length = n_bits / 32;
@@ -160,7 +169,7 @@ unsigned CRC_polynomial_fast<B>
 		crc ^= *current++;
 		for (auto j = 0; j < 32; j++)
 //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
 	}
 
 	auto rest = n_bits % 32;
@@ -173,7 +182,7 @@ unsigned CRC_polynomial_fast<B>
 		crc ^= cur;
 		for (auto j = 0; j < rest; j++)
 //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
 	}
 
 	return crc;
@@ -181,20 +190,74 @@ unsigned CRC_polynomial_fast<B>
 
 // Source of inspiration: http://create.stephan-brumme.com/crc32/ (Standard Implementation)
 template <typename B>
-unsigned CRC_polynomial_fast<B>
+uint64_t CRC_polynomial_fast<B>
 ::compute_crc_v3(const void* data, const int n_bits)
 {
 #if __BYTE_ORDER != __LITTLE_ENDIAN
 	throw runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
 #endif
 
-	unsigned crc = 0;
+	uint64_t crc = 0;
 
 	auto current = (unsigned char*)data;
 	auto length = n_bits / 8;
 	while (length--)
-		crc = (crc >> 8) ^ lut_crc32[(crc & 0xFF) ^ *current++];
+		crc = (crc >> 8) ^ lut_crc[(crc & 0xFF) ^ *current++];
+
+	auto rest = n_bits % 8;
+	if (rest != 0)
+	{
+		auto cur = *current;
+		cur <<= 8 - rest;
+		cur >>= 8 - rest;
+
+		crc ^= cur;
+		for (auto j = 0; j < rest; j++)
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
+	}
+
+	return crc;
+}
+
+// Source of inspiration: http://create.stephan-brumme.com/crc32/ (Slicing-by-8)
+template <typename B>
+uint64_t CRC_polynomial_fast<B>
+::compute_crc_v4(const void* data, const int n_bits)
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+	throw runtime_error(__FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
+#endif
+
+	const auto lut = lut_crc.data();
+
+	uint64_t crc = 0;
+
+	// process 8 bytes per step: the 64-bit register is large enough to hold any CRC up to 64 bits
+	auto current = (unsigned char*)data;
+	auto length = n_bits / 64;
+	while (length--)
+	{
+		uint64_t word;
+		std::copy(current, current + 8, (unsigned char*)&word);
+		current += 8;
+
+		word ^= crc;
+		crc = lut[7 * 256 + ((word      ) & 0xFF)] ^
+		      lut[6 * 256 + ((word >>  8) & 0xFF)] ^
+		      lut[5 * 256 + ((word >> 16) & 0xFF)] ^
+		      lut[4 * 256 + ((word >> 24) & 0xFF)] ^
+		      lut[3 * 256 + ((word >> 32) & 0xFF)] ^
+		      lut[2 * 256 + ((word >> 40) & 0xFF)] ^
+		      lut[1 * 256 + ((word >> 48) & 0xFF)] ^
+		      lut[0 * 256 + ((word >> 56)       )];
+	}
+
+	// remaining bytes
+	length = (n_bits % 64) / 8;
+	while (length--)
+		crc = (crc >> 8) ^ lut[(crc & 0xFF) ^ *current++];
 
+	// remaining bits
 	auto rest = n_bits % 8;
 	if (rest != 0)
 	{
@@ -204,7 +267,7 @@ unsigned CRC_polynomial_fast<B>
 
 		crc ^= cur;
 		for (auto j = 0; j < rest; j++)
-			crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+			crc = (crc >> 1) ^ (-(int64_t)(crc & 1) & polynomial_packed_rev);
 	}
 
 	return crc;
@@ -2,6 +2,7 @@
 #define CRC_POLYNOMIAL_FAST_HPP_
 
 #include <map>
+#include <cstdint>
 
 #include "CRC_polynomial.hpp"
 
@@ -13,8 +14,8 @@ template <typename B = int>
 class CRC_polynomial_fast : public CRC_polynomial<B>
 {
 protected:
-	mipp::vector<unsigned> lut_crc32;
-	unsigned polynomial_packed_rev;
+	mipp::vector<uint64_t> lut_crc;               // lookup tables for the slicing-by-8 (8 x 256 entries)
+	uint64_t               polynomial_packed_rev; // reflected polynomial
 
 public:
 	CRC_polynomial_fast(const int K, std::string poly_key, const int size = 0, const int n_frames = 1,
@@ -27,9 +28,10 @@ protected:
 	virtual bool _check_packed(const B *V_K          , const int frame_id);
 
 private:
-	inline unsigned compute_crc_v1(const void* data, const int n_bits);
-	inline unsigned compute_crc_v2(const void* data, const int n_bits);
-	inline unsigned compute_crc_v3(const void* data, const int n_bits);
+	inline uint64_t compute_crc_v1(const void* data, const int n_bits);
+	inline uint64_t compute_crc_v2(const void* data, const int n_bits);
+	inline uint64_t compute_crc_v3(const void* data, const int n_bits);
+	inline uint64_t compute_crc_v4(const void* data, const int n_bits);
 };
 }
 }
@@ -0,0 +1,71 @@
+#include <algorithm>
+
+#include "Tools/Algo/Bit_packer.hpp"
+
+#include "Channel_BEC.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename R>
+Channel_BEC<R>
+::Channel_BEC(const int N, const int seed, const R sigma, const int n_frames, const R p,
+              const std::string name)
+: Channel_binary<R>(N, seed, sigma, n_frames, p, name),
+  E_N(Bit_packer<int>::n_words(N) * n_frames)
+{
+}
+
+template <typename R>
+Channel_BEC<R>
+::~Channel_BEC()
+{
+}
+
+template <typename R>
+void Channel_BEC<R>
+::add_noise(const R *X_N, R *Y_N)
+{
+	const auto size = (long long)this->N * (long long)this->n_frames;
+
+	std::copy(X_N, X_N + size, Y_N);
+
+	auto pos = (long long)this->draw_skip();
+	while (pos < size)
+	{
+		Y_N[pos] = (R)0;
+		pos += (long long)this->draw_skip() +1;
+	}
+}
+
+template <typename R>
+void Channel_BEC<R>
+::add_noise_packed(const uint64_t *X_N, uint64_t *Y_N, uint64_t *E_N)
+{
+	const auto n_words = Bit_packer<int>::n_words(this->N);
+
+	for (auto f = 0; f < this->n_frames; f++)
+	{
+		this->generate_packed_mask(E_N + f * n_words, this->N);
+
+		for (auto w = 0; w < n_words; w++)
+			Y_N[f * n_words +w] = X_N[f * n_words +w] & ~E_N[f * n_words +w];
+	}
+}
+
+template <typename R>
+void Channel_BEC<R>
+::add_noise_packed(const uint64_t *X_N, uint64_t *Y_N)
+{
+	this->add_noise_packed(X_N, Y_N, this->E_N.data());
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Channel_BEC<R_32>;
+template class aff3ct::module::Channel_BEC<R_64>;
+#else
+template class aff3ct::module::Channel_BEC<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,55 @@
+#ifndef CHANNEL_BEC_HPP_
+#define CHANNEL_BEC_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Channel_binary.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R = float>
+class Channel_BEC : public Channel_binary<R> // binary erasure channel
+{
+private:
+	std::vector<uint64_t> E_N; // the erasures of the last frames (when they are not requested)
+
+public:
+	Channel_BEC(const int N, const int seed = 0, const R sigma = (R)1, const int n_frames = 1, const R p = (R)-1,
+	            const std::string name = "Channel_BEC");
+	virtual ~Channel_BEC();
+
+	/*!
+	 * \brief Erases the BPSK symbols with the erasure probability (an erased symbol is set to 0).
+	 *
+	 * \param X_N: the BPSK symbols.
+	 * \param Y_N: the received symbols.
+	 */
+	void add_noise(const R *X_N, R *Y_N); using Channel<R>::add_noise;
+
+	/*!
+	 * \brief Erases the bits with the erasure probability (hard decision fast path).
+	 *
+	 * \param X_N: the transmitted bits, packed in 64-bit words ('Bit_packer::n_words(N)' words per frame).
+	 * \param Y_N: the received bits, packed in 64-bit words (an erased bit is set to 0).
+	 * \param E_N: the erasures, packed in 64-bit words (bit set to 1 when erased).
+	 */
+	void add_noise_packed(const uint64_t *X_N, uint64_t *Y_N, uint64_t *E_N);
+
+	/*!
+	 * \brief Erases the bits with the erasure probability, the erasures are not returned (an erased bit is set to 0).
+	 *
+	 * Without the erasures, an erased bit can't be told apart from a 0 (the channel behaves as a Z-channel): the
+	 * hard decision fast path of the simulation is not used with the BEC.
+	 *
+	 * \param X_N: the transmitted bits, packed in 64-bit words ('Bit_packer::n_words(N)' words per frame).
+	 * \param Y_N: the received bits, packed in 64-bit words.
+	 */
+	virtual void add_noise_packed(const uint64_t *X_N, uint64_t *Y_N);
+};
+}
+}
+
+#endif /* CHANNEL_BEC_HPP_ */
@@ -0,0 +1,64 @@
+#include <algorithm>
+
+#include "Tools/Algo/Bit_packer.hpp"
+
+#include "Channel_BSC.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename R>
+Channel_BSC<R>
+::Channel_BSC(const int N, const int seed, const R sigma, const int n_frames, const R p,
+              const std::string name)
+: Channel_binary<R>(N, seed, sigma, n_frames, p, name)
+{
+}
+
+template <typename R>
+Channel_BSC<R>
+::~Channel_BSC()
+{
+}
+
+template <typename R>
+void Channel_BSC<R>
+::add_noise(const R *X_N, R *Y_N)
+{
+	const auto size = (long long)this->N * (long long)this->n_frames;
+
+	std::copy(X_N, X_N + size, Y_N);
+
+	auto pos = (long long)this->draw_skip();
+	while (pos < size)
+	{
+		Y_N[pos] = -X_N[pos];
+		pos += (long long)this->draw_skip() +1;
+	}
+}
+
+template <typename R>
+void Channel_BSC<R>
+::add_noise_packed(const uint64_t *X_N, uint64_t *Y_N)
+{
+	const auto n_words = Bit_packer<int>::n_words(this->N);
+
+	for (auto f = 0; f < this->n_frames; f++)
+	{
+		// the flips are directly drawn in the output frame
+		this->generate_packed_mask(Y_N + f * n_words, this->N);
+
+		for (auto w = 0; w < n_words; w++)
+			Y_N[f * n_words +w] ^= X_N[f * n_words +w];
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Channel_BSC<R_32>;
+template class aff3ct::module::Channel_BSC<R_64>;
+#else
+template class aff3ct::module::Channel_BSC<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,39 @@
+#ifndef CHANNEL_BSC_HPP_
+#define CHANNEL_BSC_HPP_
+
+#include <cstdint>
+
+#include "Channel_binary.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename R = float>
+class Channel_BSC : public Channel_binary<R> // binary symmetric channel
+{
+public:
+	Channel_BSC(const int N, const int seed = 0, const R sigma = (R)1, const int n_frames = 1, const R p = (R)-1,
+	            const std::string name = "Channel_BSC");
+	virtual ~Channel_BSC();
+
+	/*!
+	 * \brief Flips the sign of the BPSK symbols with the crossover probability.
+	 *
+	 * \param X_N: the BPSK symbols.
+	 * \param Y_N: the received symbols.
+	 */
+	void add_noise(const R *X_N, R *Y_N); using Channel<R>::add_noise;
+
+	/*!
+	 * \brief Flips the bits with the crossover probability (hard decision fast path).
+	 *
+	 * \param X_N: the transmitted bits, packed in 64-bit words ('Bit_packer::n_words(N)' words per frame).
+	 * \param Y_N: the received bits, packed in 64-bit words.
+	 */
+	virtual void add_noise_packed(const uint64_t *X_N, uint64_t *Y_N);
+};
+}
+}
+
+#endif /* CHANNEL_BSC_HPP_ */
@@ -0,0 +1,104 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+
+#include "Channel_binary.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename R>
+Channel_binary<R>
+::Channel_binary(const int N, const int seed, const R sigma, const int n_frames, const R p, const std::string name)
+: Channel<R>(N, sigma, n_frames, name),
+  p((R)0),
+  p_fixed(p),
+  log_1mp(0.0),
+  rd_engine(seed),
+  uni_dist(0.0, 1.0)
+{
+	if (p > (R)1)
+	{
+		std::stringstream message;
+		message << "'p' has to be smaller or equal to 1 ('p' = " << p << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->set_sigma(sigma);
+}
+
+template <typename R>
+Channel_binary<R>
+::~Channel_binary()
+{
+}
+
+template <typename R>
+R Channel_binary<R>
+::get_probability() const
+{
+	return this->p;
+}
+
+template <typename R>
+void Channel_binary<R>
+::set_sigma(const R sigma)
+{
+	Channel<R>::set_sigma(sigma);
+
+	// crossover probability of a BPSK hard decision: Q(1 / sigma)
+	if (this->p_fixed < (R)0)
+		this->set_probability((R)(0.5 * std::erfc(1.0 / ((double)sigma * std::sqrt(2.0)))));
+	else
+		this->set_probability(this->p_fixed);
+}
+
+template <typename R>
+void Channel_binary<R>
+::set_probability(const R p)
+{
+	if (p < (R)0 || p > (R)1)
+	{
+		std::stringstream message;
+		message << "'p' has to be between 0 and 1 ('p' = " << p << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->p       = p;
+	this->log_1mp = std::log1p(-(double)p);
+}
+
+template <typename R>
+void Channel_binary<R>
+::set_seed(const int seed)
+{
+	rd_engine.seed(seed);
+}
+
+template <typename R>
+void Channel_binary<R>
+::generate_packed_mask(uint64_t *mask, const int n_bits)
+{
+	std::fill(mask, mask + Bit_packer<int>::n_words(n_bits), (uint64_t)0);
+
+	// the geometric distribution is memoryless: the events of a frame do not depend on the previous frame
+	auto pos = (long long)this->draw_skip();
+	while (pos < (long long)n_bits)
+	{
+		mask[pos >> 6] |= (uint64_t)1 << (pos & 63);
+		pos += (long long)this->draw_skip() +1;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Channel_binary<R_32>;
+template class aff3ct::module::Channel_binary<R_64>;
+#else
+template class aff3ct::module::Channel_binary<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,88 @@
+#ifndef CHANNEL_BINARY_HPP_
+#define CHANNEL_BINARY_HPP_
+
+#include <cmath>
+#include <random>
+#include <cstdint>
+#include <limits>
+
+#include "../Channel.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Channel_binary
+ *
+ * \brief Base class of the memoryless binary channels (BSC, BEC).
+ *
+ * \tparam R: type of the reals (floating-point representation) in the Channel.
+ *
+ * The events (flips or erasures) are drawn independently with the probability 'p'. Instead of drawing one random
+ * number per bit, the distance to the next event is drawn from a geometric distribution (geometric skip sampling):
+ * the cost is proportional to the number of events instead of the number of bits.
+ * By default 'p' is the crossover probability of a BPSK hard decision on an AWGN channel: p = Q(1 / sigma), it
+ * follows the noise of the simulation. A fixed probability can be given instead, it is then kept by 'set_sigma'.
+ */
+template <typename R = float>
+class Channel_binary : public Channel<R>
+{
+protected:
+	R p;       // probability of an event (crossover or erasure)
+	R p_fixed; // fixed probability of an event, derived from sigma when negative
+
+private:
+	double                                 log_1mp; // log(1 - p)
+	std::mt19937_64                        rd_engine;
+	std::uniform_real_distribution<double> uni_dist;
+
+public:
+	Channel_binary(const int N, const int seed = 0, const R sigma = (R)1, const int n_frames = 1, const R p = (R)-1,
+	               const std::string name = "Channel_binary");
+	virtual ~Channel_binary();
+
+	R get_probability() const;
+
+	virtual void set_sigma      (const R sigma);
+	virtual void set_probability(const R p    );
+
+	void set_seed(const int seed);
+
+	/*!
+	 * \brief Adds the events to frames of packed bits (hard decision fast path, no modulation).
+	 *
+	 * \param X_N: the transmitted bits, packed in 64-bit words ('Bit_packer::n_words(N)' words per frame).
+	 * \param Y_N: the received bits, packed in 64-bit words.
+	 */
+	virtual void add_noise_packed(const uint64_t *X_N, uint64_t *Y_N) = 0;
+
+protected:
+	/*!
+	 * \brief Draws the number of event-free positions before the next event.
+	 *
+	 * \return a geometrically distributed integer (std::numeric_limits<int>::max() if 'p' = 0).
+	 */
+	inline int draw_skip()
+	{
+		if (this->p <= (R)0) return std::numeric_limits<int>::max();
+		if (this->p >= (R)1) return 0;
+
+		const auto u    = (double)1 - uni_dist(rd_engine); // u in ]0,1]
+		const auto skip = std::floor(std::log(u) / log_1mp);
+
+		return skip >= (double)std::numeric_limits<int>::max() ? std::numeric_limits<int>::max() : (int)skip;
+	}
+
+	/*!
+	 * \brief Builds the mask of the events for a frame of packed bits.
+	 *
+	 * \param mask:   the events mask ('Bit_packer::n_words(N)' words), bit set to 1 where an event occurs.
+	 * \param n_bits: number of bits in the frame.
+	 */
+	void generate_packed_mask(uint64_t *mask, const int n_bits);
+};
+}
+}
+
+#endif /* CHANNEL_BINARY_HPP_ */
@@ -0,0 +1,267 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Channel_Rayleigh_LLR_Jakes.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename R>
+constexpr float Channel_Rayleigh_LLR_Jakes<R>::default_doppler;
+
+template <typename R>
+constexpr int Channel_Rayleigh_LLR_Jakes<R>::default_n_sin;
+
+template <typename R>
+Channel_Rayleigh_LLR_Jakes<R>
+::Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, Noise<R> *noise_generator, const R doppler,
+                             const int n_sin, const int seed, const bool add_users, const R sigma,
+                             const int n_frames, const std::string name)
+: Channel<R>(N, sigma, n_frames, name),
+  complex(complex),
+  add_users(add_users),
+  doppler(doppler),
+  n_sin(n_sin),
+  n_symbs(complex ? N / 2 : N),
+  n_proc(add_users ? n_frames : 1),
+  gains_re(n_symbs * n_frames),
+  gains_im(n_symbs * n_frames),
+  lanes(mipp::nElReg<R>()),
+  omegas(n_proc * n_sin),
+  phis(n_proc * n_sin),
+  phases(n_proc * n_sin),
+  noise_generator(noise_generator)
+{
+	if (noise_generator == nullptr)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
+
+	this->check_parameters();
+	this->reset(seed);
+}
+
+template <typename R>
+Channel_Rayleigh_LLR_Jakes<R>
+::Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, const R doppler, const int n_sin, const int seed,
+                             const bool add_users, const R sigma, const int n_frames, const std::string name)
+: Channel<R>(N, sigma, n_frames, name),
+  complex(complex),
+  add_users(add_users),
+  doppler(doppler),
+  n_sin(n_sin),
+  n_symbs(complex ? N / 2 : N),
+  n_proc(add_users ? n_frames : 1),
+  gains_re(n_symbs * n_frames),
+  gains_im(n_symbs * n_frames),
+  lanes(mipp::nElReg<R>()),
+  omegas(n_proc * n_sin),
+  phis(n_proc * n_sin),
+  phases(n_proc * n_sin),
+  noise_generator(new tools::Noise_std<R>(seed))
+{
+	this->check_parameters();
+	this->reset(seed);
+}
+
+template <typename R>
+Channel_Rayleigh_LLR_Jakes<R>
+::~Channel_Rayleigh_LLR_Jakes()
+{
+	delete noise_generator;
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::check_parameters()
+{
+	if (complex && this->N % 2)
+	{
+		std::stringstream message;
+		message << "'N' has to be divisible by 2 ('N' = " << this->N << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (doppler < (R)0)
+	{
+		std::stringstream message;
+		message << "'doppler' has to be positive ('doppler' = " << doppler << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_sin <= 0)
+	{
+		std::stringstream message;
+		message << "'n_sin' has to be greater than 0 ('n_sin' = " << n_sin << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::reset(const int seed)
+{
+	const auto pi = 3.14159265358979323846;
+
+	// the noise generator is seeded with 'seed', use another stream for the fading processes
+	rd_engine.seed(seed + 1);
+	std::uniform_real_distribution<double> uni_dist(-pi, pi);
+
+	for (auto l = 0; l < mipp::nElReg<R>(); l++)
+		lanes[l] = (R)l;
+
+	for (auto p = 0; p < n_proc; p++)
+		for (auto m = 0; m < n_sin; m++)
+		{
+			const auto theta = uni_dist(rd_engine);
+			const auto alpha = (2.0 * pi * m + theta) / (double)n_sin;
+
+			omegas[p * n_sin + m] = (R)(2.0 * pi * (double)doppler * std::cos(alpha));
+			phases[p * n_sin + m] = uni_dist(rd_engine) + pi;
+		}
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::generate_gains(R *h_re, R *h_im, const int length, const int proc_id)
+{
+	const auto twopi  = 2.0 * 3.14159265358979323846;
+	const auto scale  = (R)1 / (R)std::sqrt((R)n_sin);
+	const auto omegas = this->omegas.data() + proc_id * n_sin;
+	const auto phis   = this->phis  .data() + proc_id * n_sin;
+	const auto phases = this->phases.data() + proc_id * n_sin;
+
+	for (auto m = 0; m < n_sin; m++)
+		phis[m] = (R)phases[m];
+
+	// the sinusoids are accumulated in registers, the time instants are spread over the SIMD lanes
+	const auto r_lanes = mipp::Reg<R>(lanes.data());
+	const auto vec_loop_size = (length / mipp::nElReg<R>()) * mipp::nElReg<R>();
+	for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+	{
+		const auto r_t = r_lanes + mipp::Reg<R>((R)i);
+
+		mipp::Reg<R> r_re = (R)0, r_im = (R)0;
+		for (auto m = 0; m < n_sin; m++)
+		{
+			const auto r_theta = mipp::Reg<R>(phis[m]) + mipp::Reg<R>(omegas[m]) * r_t;
+
+			mipp::Reg<R> r_sin, r_cos;
+			mipp::sincos(r_theta, r_sin, r_cos);
+
+			r_re += r_cos;
+			r_im += r_sin;
+		}
+
+		(r_re * scale).store(&h_re[i]);
+		(r_im * scale).store(&h_im[i]);
+	}
+
+	for (auto i = vec_loop_size; i < length; i++)
+	{
+		auto re = (R)0, im = (R)0;
+		for (auto m = 0; m < n_sin; m++)
+		{
+			const auto theta = phis[m] + omegas[m] * (R)i;
+
+			re += std::cos(theta);
+			im += std::sin(theta);
+		}
+
+		h_re[i] = re * scale;
+		h_im[i] = im * scale;
+	}
+
+	// move the processes forward in time (the phases are kept in double precision to avoid a drift)
+	for (auto m = 0; m < n_sin; m++)
+		phases[m] = std::fmod(phases[m] + (double)omegas[m] * (double)length, twopi);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::add_noise(const R *X_N, R *Y_N, R *H_N)
+{
+	if (add_users && this->n_frames > 1)
+	{
+		// each user has its own fading process, all the users are observed at the same time instants
+		for (auto f = 0; f < this->n_frames; f++)
+			this->generate_gains(this->gains_re.data() + f * n_symbs, this->gains_im.data() + f * n_symbs, n_symbs, f);
+		noise_generator->generate(this->noise.data(), this->N, this->sigma);
+
+		std::fill(Y_N, Y_N + this->N, (R)0);
+
+		if (this->complex)
+		{
+			for (auto f = 0; f < this->n_frames; f++)
+			{
+				for (auto i = 0; i < n_symbs; i++)
+				{
+					const auto h_re = H_N[f * this->N + 2*i   ] = this->gains_re[f * n_symbs +i];
+					const auto h_im = H_N[f * this->N + 2*i +1] = this->gains_im[f * n_symbs +i];
+
+					Y_N[2*i   ] += X_N[f * this->N + 2*i   ] * h_re - X_N[f * this->N + 2*i +1] * h_im;
+					Y_N[2*i +1] += X_N[f * this->N + 2*i +1] * h_re + X_N[f * this->N + 2*i   ] * h_im;
+				}
+			}
+		}
+		else
+		{
+			for (auto f = 0; f < this->n_frames; f++)
+			{
+				for (auto i = 0; i < this->N; i++)
+				{
+					const auto h_re = this->gains_re[f * this->N +i];
+					const auto h_im = this->gains_im[f * this->N +i];
+
+					H_N[f * this->N +i] = std::sqrt(h_re * h_re + h_im * h_im);
+					Y_N[i] += X_N[f * this->N +i] * H_N[f * this->N +i];
+				}
+			}
+		}
+		for (auto i = 0; i < this->N; i++)
+			Y_N[i] += this->noise[i];
+	}
+	else
+	{
+		// the frames are consecutive in time: one process covers all of them
+		this->generate_gains(this->gains_re.data(), this->gains_im.data(), n_symbs * this->n_frames, 0);
+		noise_generator->generate(this->noise, this->sigma);
+
+		if (this->complex)
+		{
+			for (auto i = 0; i < n_symbs * this->n_frames; i++)
+			{
+				const auto h_re = H_N[2*i   ] = this->gains_re[i];
+				const auto h_im = H_N[2*i +1] = this->gains_im[i];
+
+				const auto n_re = this->noise[2*i   ];
+				const auto n_im = this->noise[2*i +1];
+
+				Y_N[2*i   ] = (X_N[2*i   ] * h_re - X_N[2*i +1] * h_im) + n_re;
+				Y_N[2*i +1] = (X_N[2*i +1] * h_re + X_N[2*i   ] * h_im) + n_im;
+			}
+		}
+		else
+		{
+			for (auto i = 0; i < this->N * this->n_frames; i++)
+			{
+				const auto h_re = this->gains_re[i];
+				const auto h_im = this->gains_im[i];
+
+				H_N[i] = std::sqrt(h_re * h_re + h_im * h_im);
+				Y_N[i] = X_N[i] * H_N[i] + this->noise[i];
+			}
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Channel_Rayleigh_LLR_Jakes<R_32>;
+template class aff3ct::module::Channel_Rayleigh_LLR_Jakes<R_64>;
+#else
+template class aff3ct::module::Channel_Rayleigh_LLR_Jakes<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,79 @@
+#ifndef CHANNEL_RAYLEIGH_LLR_JAKES_HPP_
+#define CHANNEL_RAYLEIGH_LLR_JAKES_HPP_
+
+#include <random>
+#include <vector>
+
+#include "Tools/Algo/Noise/Noise.hpp"
+#include "Tools/Algo/Noise/Standard/Noise_std.hpp"
+
+#include "../Channel.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Channel_Rayleigh_LLR_Jakes
+ *
+ * \brief Time-correlated flat Rayleigh fading channel (Clarke/Jakes Doppler spectrum).
+ *
+ * \tparam R: type of the reals (floating-point representation) in the Channel.
+ *
+ * The fading process is generated with a sum of sinusoids with random Doppler angles and phases:
+ * h(t) = 1/sqrt(M) * sum_{m=0}^{M-1} exp(j * (2 * pi * f_d * t * cos(alpha_m) + phi_m)), with
+ * alpha_m = (2 * pi * m + theta_m) / M. The time t is counted in channel symbols and keeps increasing from one call
+ * to another: the consecutive frames see a continuous fading process.
+ */
+template <typename R = float>
+class Channel_Rayleigh_LLR_Jakes : public Channel<R>
+{
+public:
+	// default parameters of the fading (also the defaults of the factory and of the launchers)
+	static constexpr float default_doppler = 0.01f; // normalized Doppler frequency (f_d * T_s)
+	static constexpr int   default_n_sin   = 16;    // number of sinusoids per fading process
+
+private:
+	const bool complex;
+	const bool add_users;
+	const R    doppler; // normalized Doppler frequency (f_d * T_s)
+	const int  n_sin;   // number of sinusoids per fading process
+	const int  n_symbs; // number of fading coefficients per frame
+	const int  n_proc;  // number of independent fading processes (one per user or one for all the frames)
+
+	mipp::vector<R>     gains_re;
+	mipp::vector<R>     gains_im;
+	mipp::vector<R>     lanes;   // [0, 1, ..., mipp::nElReg<R>() -1]
+	mipp::vector<R>     omegas;  // angular Doppler shifts of the sinusoids (n_proc * n_sin)
+	mipp::vector<R>     phis;    // phases of the sinusoids at the beginning of the current block (n_proc * n_sin)
+	std::vector<double> phases;  // phases accumulated over the time, in [0, 2pi[ (n_proc * n_sin)
+
+	std::mt19937     rd_engine;
+	tools::Noise<R> *noise_generator;
+
+public:
+	Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, tools::Noise<R> *noise_generator,
+	                           const R doppler = (R)default_doppler, const int n_sin = default_n_sin,
+	                           const int seed = 0, const bool add_users = false, const R sigma = (R)1,
+	                           const int n_frames = 1, const std::string name = "Channel_Rayleigh_LLR_Jakes");
+	Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, const R doppler = (R)default_doppler,
+	                           const int n_sin = default_n_sin, const int seed = 0, const bool add_users = false,
+	                           const R sigma = (R)1, const int n_frames = 1,
+	                           const std::string name = "Channel_Rayleigh_LLR_Jakes");
+	virtual ~Channel_Rayleigh_LLR_Jakes();
+
+	virtual void add_noise(const R *X_N, R *Y_N, R *H_N); using Channel<R>::add_noise;
+
+	/*!
+	 * \brief Draws a new set of Doppler angles and phases and restarts the fading processes at t = 0.
+	 */
+	void reset(const int seed);
+
+private:
+	void check_parameters();
+	void generate_gains(R *h_re, R *h_im, const int length, const int proc_id);
+};
+}
+}
+
+#endif /* CHANNEL_RAYLEIGH_LLR_JAKES_HPP_ */
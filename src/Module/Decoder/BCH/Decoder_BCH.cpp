@@ -46,6 +46,29 @@ void Decoder_BCH<B, R>
 		this->YH_N[j] = (Y_N[j] > 0)? 0 : 1; // hard decision on the input
 	auto d_load = std::chrono::steady_clock::now() - t_load;
 
+	this->d_load_total += d_load;
+
+	this->_decode(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_BCH<B, R>
+::_hard_decode_packed(const uint64_t *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	for (int j = 0; j < this->N; j++)
+		this->YH_N[j] = (B)((Y_N[j >> 6] >> (j & 63)) & 1); // the input is already a hard decision
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	this->d_load_total += d_load;
+
+	this->_decode(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_BCH<B, R>
+::_decode(B *V_K)
+{
 	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	int i, j, u, q, t2, count = 0, syn_error = 0;
 
@@ -213,7 +236,6 @@ void Decoder_BCH<B, R>
 		V_K[i] = YH_N[i+this->N-this->K];
 	auto d_store = std::chrono::steady_clock::now() - t_store;
 
-	this->d_load_total  += d_load;
 	this->d_decod_total += d_decod;
 	this->d_store_total += d_store;
 }
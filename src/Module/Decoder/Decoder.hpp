@@ -10,11 +10,13 @@
 
 #include <chrono>
 #include <string>
+#include <cstdint>
 #include <vector>
 #include <sstream>
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -194,6 +196,77 @@ public:
 		}
 	}
 
+	/*!
+	 * \brief Decodes the hard decisions of a binary channel (hard input, hard output).
+	 *
+	 * Only the hard decision decoders implement this entry point, the other decoders throw an unimplemented_error.
+	 *
+	 * \param Y_N: the received bits packed in 64-bit words ('tools::Bit_packer<B>::n_words(N)' words per frame).
+	 * \param V_K: a decoded codeword (only the information bits).
+	 */
+	void hard_decode_packed(const std::vector<uint64_t>& Y_N, mipp::vector<B>& V_K)
+	{
+		if (tools::Bit_packer<B>::n_words(this->N) * this->n_frames != (int)Y_N.size())
+		{
+			std::stringstream message;
+			message << "'Y_N.size()' has to be equal to 'n_words(N)' * 'n_frames' ('Y_N.size()' = " << Y_N.size()
+			        << ", 'n_words(N)' = " << tools::Bit_packer<B>::n_words(this->N)
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (this->K * this->n_frames != (int)V_K.size())
+		{
+			std::stringstream message;
+			message << "'V_K.size()' has to be equal to 'K' * 'n_frames' ('V_K.size()' = " << V_K.size()
+			        << ", 'K' = " << this->K << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->hard_decode_packed(Y_N.data(), V_K.data());
+	}
+
+	virtual void hard_decode_packed(const uint64_t *Y_N, B *V_K)
+	{
+		this->d_load_total  = std::chrono::nanoseconds(0);
+		this->d_decod_total = std::chrono::nanoseconds(0);
+		this->d_store_total = std::chrono::nanoseconds(0);
+
+		const auto n_words = tools::Bit_packer<B>::n_words(this->N);
+		for (auto f = 0; f < this->n_frames; f++)
+			this->_hard_decode_packed(Y_N + f * n_words, V_K + f * this->K, f);
+	}
+
+	/*!
+	 * \brief Adds a noisy frame to the input queue of the streaming decoding.
+	 *
+	 * In the streaming decoding, each SIMD lane holds a frame until it is decoded and is then refilled with the next
+	 * frame of the input queue (the number of iterations of a frame does not depend on the other frames). Only the
+	 * decoders with such a scheduler implement the streaming decoding, the other decoders throw an unimplemented_error.
+	 *
+	 * \param Y_N:      a noisy frame.
+	 * \param frame_id: identifier of the frame (given back with the decoded frame).
+	 */
+	virtual void push_frame(const R *Y_N, const uint64_t frame_id)
+	{
+		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+	}
+
+	/*!
+	 * \brief Gets a decoded frame of the streaming decoding, the decoder iterates until a frame is decoded.
+	 *
+	 * The frames are returned in the order of the end of their decoding (not in the order of the input queue).
+	 *
+	 * \param V_K:      a decoded codeword (only the information bits).
+	 * \param frame_id: identifier of the decoded frame.
+	 *
+	 * \return false if there is no frame left to decode (and then V_K and frame_id are not set).
+	 */
+	virtual bool pull_frame(B *V_K, uint64_t &frame_id)
+	{
+		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+	}
+
 	/*!
 	 * \brief Gets the duration of the data loading in the decoding process.
 	 *
@@ -229,6 +302,11 @@ protected:
 	{
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 	}
+
+	virtual void _hard_decode_packed(const uint64_t *Y_N, B *V_K, const int frame_id)
+	{
+		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+	}
 };
 }
 }
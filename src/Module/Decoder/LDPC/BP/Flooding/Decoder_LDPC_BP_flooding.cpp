@@ -62,6 +62,11 @@ Decoder_LDPC_BP_flooding<B,R>
 	const auto &CN_to_VN = H.get_col_to_rows();
 	const auto &VN_to_CN = H.get_row_to_cols();
 
+	// first branch of each variable node
+	std::vector<int> VN_offsets(VN_to_CN.size() +1, 0);
+	for (auto i = 0; i < (int)VN_to_CN.size(); i++)
+		VN_offsets[i +1] = VN_offsets[i] + (int)VN_to_CN[i].size();
+
 	auto k = 0;
 	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
 	{
@@ -69,10 +74,7 @@ Decoder_LDPC_BP_flooding<B,R>
 		{
 			auto id_V = CN_to_VN[i][j];
 
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
+			auto branch_id = VN_offsets[id_V] + connections[id_V];
 			connections[id_V]++;
 
 			if (connections[id_V] > (int)VN_to_CN[id_V].size())
@@ -0,0 +1,275 @@
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Decoder_LDPC_BP_flooding_inter.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_inter<B,R>
+::Decoder_LDPC_BP_flooding_inter(const int &K, const int &N, const int& n_ite,
+                                 const Sparse_matrix &H,
+                                 const std::vector<unsigned> &info_bits_pos,
+                                 const bool enable_syndrome,
+                                 const int syndrome_depth,
+                                 const int n_frames,
+                                 const std::string name)
+: Decoder_SISO<B,R>(K, N, n_frames, mipp::nElReg<R>(), name                       ),
+  n_ite             (n_ite                                                        ),
+  n_V_nodes         (N                                                            ), // same as N but more explicit
+  n_C_nodes         ((int)H.get_n_cols()                                          ),
+  n_branches        ((int)H.get_n_connections()                                   ),
+  enable_syndrome   (enable_syndrome                                              ),
+  syndrome_depth    (syndrome_depth                                               ),
+  init_flag         (true                                                         ),
+  info_bits_pos     (info_bits_pos                                                ),
+  cur_syndrome_depth(mipp::nElReg<R>(), 0                                         ),
+  Y_N_reordered     (N                                                            ),
+  Lp_N              (N                                                            ),
+  C_to_V            (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->n_branches)),
+  V_to_C            (this->n_branches                                             ),
+  V_K_reordered     (K                                                            )
+{
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << H.get_n_rows() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (mipp::nElReg<B>() != mipp::nElReg<R>())
+	{
+		std::stringstream message;
+		message << "'B' and 'R' have to fill the same number of SIMD lanes ('mipp::nElReg<B>()' = "
+		        << mipp::nElReg<B>() << ", 'mipp::nElReg<R>()' = " << mipp::nElReg<R>() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	transpose.resize(this->n_branches);
+	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
+
+	const auto &CN_to_VN = H.get_col_to_rows();
+	const auto &VN_to_CN = H.get_row_to_cols();
+
+	// first branch of each variable node
+	std::vector<int> VN_offsets(VN_to_CN.size() +1, 0);
+	for (auto i = 0; i < (int)VN_to_CN.size(); i++)
+		VN_offsets[i +1] = VN_offsets[i] + (int)VN_to_CN[i].size();
+
+	auto k = 0;
+	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+	{
+		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
+		{
+			auto id_V = CN_to_VN[i][j];
+
+			auto branch_id = VN_offsets[id_V] + connections[id_V];
+			connections[id_V]++;
+
+			if (connections[id_V] > (int)VN_to_CN[id_V].size())
+			{
+				std::stringstream message;
+				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
+				        << id_V << ", 'connections[id_V]' = " << connections[id_V] << ", 'VN_to_CN[id_V].size()' = "
+				        << VN_to_CN[id_V].size() << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			transpose[k] = branch_id;
+			k++;
+		}
+	}
+
+	n_variables_per_parity.resize(H.get_n_cols());
+	for (auto i = 0; i < (int)H.get_n_cols(); i++)
+		n_variables_per_parity[i] = (unsigned char)CN_to_VN[i].size();
+
+	n_parities_per_variable.resize(H.get_n_rows());
+	for (auto i = 0; i < (int)H.get_n_rows(); i++)
+		n_parities_per_variable[i] = (unsigned char)VN_to_CN[i].size();
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_inter<B,R>
+::~Decoder_LDPC_BP_flooding_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_soft_decode(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		this->Lp_N[i] -= this->Y_N_reordered[i];
+
+	std::array<R*,mipp::nElReg<R>()> frames;
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N2 + f * this->N;
+	Reorderer_static<R,mipp::nElReg<R>()>::apply_rev((R*)this->Lp_N.data(), frames, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		const auto zero = mipp::Reg<R>((R)0);
+		std::fill(this->C_to_V[cur_wave].begin(), this->C_to_V[cur_wave].end(), zero);
+
+		if (cur_wave == this->n_dec_waves -1) this->init_flag = false;
+	}
+
+	std::array<const R*,mipp::nElReg<R>()> frames;
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
+	Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reordered.data(), this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_hard_decode(const R *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N, frame_id);
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->BP_decode(frame_id);
+	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K, frame_id);
+	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+	this->d_load_total  += d_load;
+	this->d_decod_total += d_decod;
+	this->d_store_total += d_store;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::_store(B *V_K, const int frame_id)
+{
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_K_reordered[i] = mipp::cast<R,B>(this->Lp_N[k]) >> (sizeof(B) * 8 - 1);
+	}
+
+	std::array<B*,mipp::nElReg<R>()> frames;
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_K + f * this->K;
+	Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_K_reordered.data(), frames, this->K);
+
+	// set the flag so C_to_V structure can be reset to 0 only at the beginning of the loop in iterative decoding
+	if (cur_wave == this->n_dec_waves -1) this->init_flag = true;
+}
+
+// BP algorithm
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_inter<B,R>
+::BP_decode(const int frame_id)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+
+	// the lanes of the last wave which do not contain a frame are done from the beginning
+	const auto n_frames_wave = std::min(n_lanes, Decoder<B,R>::n_frames - frame_id);
+	for (auto l = 0; l < n_lanes; l++)
+		this->cur_syndrome_depth[l] = (this->enable_syndrome && l >= n_frames_wave) ? this->syndrome_depth : 0;
+
+	R lanes[n_lanes];
+	for (auto l = 0; l < n_lanes; l++)
+		lanes[l] = (R)(this->cur_syndrome_depth[l] < this->syndrome_depth ? 1 : 0);
+
+	const auto zero = mipp::Reg<R>((R)0);
+	auto active = mipp::Reg<R>(lanes) != zero;
+
+	// actual decoding
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		// specific inner code depending on the selected implementation (min-sum or sum-product for example)
+		const auto syndrome = this->BP_process(active, this->V_to_C, this->C_to_V[cur_wave]);
+
+		// stop criterion (lane by lane: the messages of the lanes which are done are not updated anymore)
+		if (this->enable_syndrome)
+		{
+			auto n_active = 0;
+			for (auto l = 0; l < n_lanes; l++)
+			{
+				auto &depth = this->cur_syndrome_depth[l];
+				if (depth < this->syndrome_depth)
+				{
+					depth = syndrome[l] ? 0 : depth +1;
+					if (depth < this->syndrome_depth)
+						n_active++;
+				}
+				lanes[l] = (R)(depth < this->syndrome_depth ? 1 : 0);
+			}
+
+			if (n_active == 0)
+				break;
+
+			active = mipp::Reg<R>(lanes) != zero;
+		}
+	}
+
+	// begining of the iteration upon all the matrix lines
+	const auto *C_to_V_ptr = this->C_to_V[cur_wave].data();
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		const auto length = this->n_parities_per_variable[i];
+
+		auto sum_C_to_V = zero;
+		for (auto j = 0; j < length; j++)
+			sum_C_to_V += C_to_V_ptr[j];
+
+		// filling the output
+		this->Lp_N[i] = this->Y_N_reordered[i] + sum_C_to_V;
+
+		C_to_V_ptr += length;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,75 @@
+#ifndef DECODER_LDPC_BP_FLOODING_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_INTER_HPP_
+
+#include "../../../Decoder_SISO.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Flooding BP with the inter-frame SIMD strategy: each SIMD lane decodes its own frame ('mipp::nElReg<R>()' frames per
+ * wave). The stop criterion is evaluated lane by lane: the messages of a frame are frozen as soon as its syndrome is
+ * verified (so each frame is decoded as with the sequential decoders) and the wave stops when all its frames are done.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_inter : public Decoder_SISO<B,R>
+{
+protected:
+	const int  n_ite;      // number of iterations to perform
+	const int  n_V_nodes;  // number of variable nodes (= N)
+	const int  n_C_nodes;  // number of check    nodes (= N - K)
+	const int  n_branches; // number of branched in the bi-partite graph (connexions between the V and C nodes)
+
+	const bool enable_syndrome;
+	const int  syndrome_depth;
+
+	// reset so C_to_V structures can be cleared only at the begining of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	mipp::vector<unsigned char> n_variables_per_parity;
+	mipp::vector<unsigned char> n_parities_per_variable;
+	mipp::vector<unsigned int > transpose;
+
+	std::vector<int> cur_syndrome_depth; // number of successive verified syndromes of each lane
+
+	// data structures for iterative decoding (one SIMD lane per frame)
+	            mipp::vector<mipp::Reg<R>>  Y_N_reordered; // channel LLRs
+	            mipp::vector<mipp::Reg<R>>  Lp_N;          // a posteriori information
+	std::vector<mipp::vector<mipp::Reg<R>>> C_to_V;        // check    nodes to variable nodes messages (for each wave)
+	            mipp::vector<mipp::Reg<R>>  V_to_C;        // variable nodes to check    nodes messages
+	            mipp::vector<mipp::Reg<B>>  V_K_reordered; // hard decisions
+
+	Decoder_LDPC_BP_flooding_inter(const int &K, const int &N, const int& n_ite,
+	                               const tools::Sparse_matrix &H,
+	                               const std::vector<unsigned> &info_bits_pos,
+	                               const bool enable_syndrome = true,
+	                               const int syndrome_depth = 1,
+	                               const int n_frames = 1,
+	                               const std::string name = "Decoder_LDPC_BP_flooding_inter");
+	virtual ~Decoder_LDPC_BP_flooding_inter();
+
+	// soft decode
+	void _soft_decode(const R *Y_N1, R *Y_N2, const int frame_id);
+
+	// hard decoder (load -> decode -> store)
+	void _load       (const R *Y_N,         const int frame_id);
+	void _hard_decode(const R *Y_N, B *V_K, const int frame_id);
+	void _store      (              B *V_K, const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const int frame_id);
+
+	// one iteration: the C_to_V messages are only updated in the 'active' lanes, returns the lanes where the syndrome
+	// is not verified
+	virtual mipp::Msk<mipp::N<R>()> BP_process(const mipp::Msk<mipp::N<R>()> &active,
+	                                           mipp::vector<mipp::Reg<R>> &V_to_C,
+	                                           mipp::vector<mipp::Reg<R>> &C_to_V) = 0;
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_INTER_HPP_ */
@@ -0,0 +1,323 @@
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Decoder_LDPC_BP_flooding_GALA_inter.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_GALA_inter<B,R>
+::Decoder_LDPC_BP_flooding_GALA_inter(const int &K, const int &N, const int& n_ite, const Sparse_matrix &H,
+                                      const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                      const int syndrome_depth, const int n_frames, const std::string name)
+
+: Decoder_SISO<B,R>(K, N, n_frames, mipp::nElReg<R>(), name),
+  n_ite             (n_ite                                 ),
+  H                 (H                                     ),
+  enable_syndrome   (enable_syndrome                       ),
+  syndrome_depth    (syndrome_depth                        ),
+  info_bits_pos     (info_bits_pos                         ),
+  cur_syndrome_depth(mipp::nElReg<R>(), 0                  ),
+  Y_N_reordered     (N                                     ),
+  HY_N              (N                                     ),
+  V_N               (N                                     ),
+  C_to_V_messages   (H.get_n_connections()                 ),
+  V_to_C_messages   (H.get_n_connections()                 ),
+  V_K_reordered     (K                                     ),
+  V_K_pad           (K                                     )
+{
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << H.get_n_rows() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (mipp::nElReg<B>() != mipp::nElReg<R>())
+	{
+		std::stringstream message;
+		message << "'B' and 'R' have to fill the same number of SIMD lanes ('mipp::nElReg<B>()' = "
+		        << mipp::nElReg<B>() << ", 'mipp::nElReg<R>()' = " << mipp::nElReg<R>() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	transpose.resize(H.get_n_connections());
+	mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
+
+	const auto &CN_to_VN = H.get_col_to_rows();
+	const auto &VN_to_CN = H.get_row_to_cols();
+
+	// first branch of each variable node
+	std::vector<int> VN_offsets(VN_to_CN.size() +1, 0);
+	for (auto i = 0; i < (int)VN_to_CN.size(); i++)
+		VN_offsets[i +1] = VN_offsets[i] + (int)VN_to_CN[i].size();
+
+	auto k = 0;
+	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
+	{
+		for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
+		{
+			auto id_V = CN_to_VN[i][j];
+
+			auto branch_id = VN_offsets[id_V] + connections[id_V];
+			connections[id_V]++;
+
+			if (connections[id_V] > (int)VN_to_CN[id_V].size())
+			{
+				std::stringstream message;
+				message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' "
+				        << "('id_V' = " << id_V << ", 'connections[id_V]' = " << connections[id_V]
+				        << ", 'VN_to_CN[id_V].size()' = " << VN_to_CN[id_V].size() << ")'.";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			transpose[k] = branch_id;
+			k++;
+		}
+	}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_GALA_inter<B,R>
+::~Decoder_LDPC_BP_flooding_GALA_inter()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_GALA_inter<B,R>
+::hard_decode_packed(const uint64_t *Y_N, B *V_K)
+{
+	this->d_load_total  = std::chrono::nanoseconds(0);
+	this->d_decod_total = std::chrono::nanoseconds(0);
+	this->d_store_total = std::chrono::nanoseconds(0);
+
+	constexpr auto n_lanes = mipp::nElReg<R>();
+	const auto n_words = Bit_packer<B>::n_words(this->N);
+
+	for (auto w = 0; w < this->n_dec_waves; w++)
+	{
+		const auto frame_id      = w * n_lanes;
+		const auto n_frames_wave = std::min(n_lanes, Decoder<B,R>::n_frames - frame_id);
+
+		auto t_load = std::chrono::steady_clock::now(); // ------------------------------------------------------- LOAD
+		// the bits are unpacked directly in the interleaved layout (the lanes without frame receive zeros)
+		auto HY_N_ptr = (B*)this->HY_N.data();
+		for (auto f = 0; f < n_frames_wave; f++)
+		{
+			const auto Y_N_frame = Y_N + (frame_id + f) * n_words;
+			for (auto i = 0; i < this->N; i++)
+				HY_N_ptr[i * n_lanes + f] = (B)((Y_N_frame[i >> 6] >> (i & 63)) & 1);
+		}
+		for (auto f = n_frames_wave; f < n_lanes; f++)
+			for (auto i = 0; i < this->N; i++)
+				HY_N_ptr[i * n_lanes + f] = (B)0;
+		auto d_load = std::chrono::steady_clock::now() - t_load;
+
+		this->d_load_total += d_load;
+
+		this->_decode(frame_id);
+		this->_store(V_K + frame_id * this->K, frame_id);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_GALA_inter<B,R>
+::_hard_decode(const R *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	std::array<const R*,mipp::nElReg<R>()> frames;
+	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
+	Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reordered.data(), this->N);
+
+	const auto zero_R = mipp::Reg<R>((R)0);
+	const auto zero_B = mipp::Reg<B>((B)0);
+	const auto one_B  = mipp::Reg<B>((B)1);
+	for (auto i = 0; i < this->N; i++)
+		HY_N[i] = mipp::blend(one_B, zero_B, this->Y_N_reordered[i] < zero_R);
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	this->d_load_total += d_load;
+
+	this->_decode(frame_id);
+	this->_store(V_K, frame_id);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_GALA_inter<B,R>
+::_decode(const int frame_id)
+{
+	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	constexpr auto n_lanes = mipp::nElReg<R>();
+
+	const auto zero = mipp::Reg<B>((B)0);
+	const auto one  = mipp::Reg<B>((B)1);
+
+	// the lanes of the last wave which do not contain a frame are done from the beginning
+	const auto n_frames_wave = std::min(n_lanes, Decoder<B,R>::n_frames - frame_id);
+	B lanes[n_lanes];
+	for (auto l = 0; l < n_lanes; l++)
+	{
+		cur_syndrome_depth[l] = (this->enable_syndrome && l >= n_frames_wave) ? this->syndrome_depth : 0;
+		lanes[l] = (B)(cur_syndrome_depth[l] < this->syndrome_depth ? 1 : 0);
+	}
+	auto active = mipp::Reg<B>(lanes) != zero;
+
+	for (auto ite = 0; ite < n_ite; ite++)
+	{
+		auto C_to_V_mess_ptr = C_to_V_messages.data();
+		auto V_to_C_mess_ptr = V_to_C_messages.data();
+
+		// V -> C (for each variable nodes)
+		for (auto i = 0; i < (int)H.get_n_rows(); i++)
+		{
+			const auto node_degree = (int)H.get_cols_from_row(i).size();
+			const auto cur_state   = HY_N[i];
+
+			if (ite > 0)
+			{
+				// the state is flipped when all the other incoming messages disagree with the channel
+				auto n_disagree = zero;
+				for (auto k = 0; k < node_degree; k++)
+					n_disagree += C_to_V_mess_ptr[k] ^ cur_state;
+
+				const auto all_others = mipp::Reg<B>((B)(node_degree -1));
+				for (auto j = 0; j < node_degree; j++)
+				{
+					const auto flip = (n_disagree - (C_to_V_mess_ptr[j] ^ cur_state)) == all_others;
+					V_to_C_mess_ptr[j] = mipp::blend(cur_state ^ one, cur_state, flip);
+				}
+			}
+			else
+				for (auto j = 0; j < node_degree; j++)
+					V_to_C_mess_ptr[j] = cur_state;
+
+			C_to_V_mess_ptr += node_degree; // jump to the next node
+			V_to_C_mess_ptr += node_degree; // jump to the next node
+		}
+
+		// C -> V (for each check nodes, only in the active lanes)
+		auto syndrome = zero;
+		auto transpose_ptr = this->transpose.data();
+		for (auto i = 0; i < (int)H.get_n_cols(); i++)
+		{
+			const auto node_degree = (int)H.get_rows_from_col(i).size();
+
+			// accumulate the incoming information in CN
+			auto acc = zero;
+			for (auto j = 0; j < node_degree; j++)
+				acc ^= V_to_C_messages[transpose_ptr[j]];
+
+			// regenerate the CN outcoming values
+			for (auto j = 0; j < node_degree; j++)
+			{
+				const auto res = acc ^ V_to_C_messages[transpose_ptr[j]];
+				C_to_V_messages[transpose_ptr[j]] = mipp::blend(res, C_to_V_messages[transpose_ptr[j]], active);
+			}
+
+			syndrome |= acc; // compute the syndrome
+
+			transpose_ptr += node_degree; // jump to the next node
+		}
+
+		// stop criterion (lane by lane: the messages of the lanes which are done are not updated anymore)
+		if (this->enable_syndrome)
+		{
+			auto n_active = 0;
+			for (auto l = 0; l < n_lanes; l++)
+			{
+				auto &depth = cur_syndrome_depth[l];
+				if (depth < this->syndrome_depth)
+				{
+					depth = syndrome[l] ? 0 : depth +1;
+					if (depth < this->syndrome_depth)
+						n_active++;
+				}
+				lanes[l] = (B)(depth < this->syndrome_depth ? 1 : 0);
+			}
+
+			if (n_active == 0)
+				break;
+
+			active = mipp::Reg<B>(lanes) != zero;
+		}
+	}
+	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	auto C_to_V_ptr = C_to_V_messages.data();
+	// for the K variable nodes (make a majority vote with the entering messages)
+	for (auto i = 0; i < this->N; i++)
+	{
+		const auto node_degree = (int)H.get_cols_from_row(i).size();
+
+		auto n_ones = zero;
+		for (auto j = 0; j < node_degree; j++)
+			n_ones += C_to_V_ptr[j];
+
+		// count = (number of ones) - (number of zeros)
+		auto count = n_ones + n_ones - mipp::Reg<B>((B)node_degree);
+		if (node_degree % 2 == 0)
+			count += HY_N[i] + HY_N[i] - one;
+
+		// take the hard decision
+		this->V_N[i] = mipp::blend(one, zero, count > zero);
+
+		C_to_V_ptr += node_degree; // jump to the next node
+	}
+
+	for (auto i = 0; i < this->K; i++)
+		V_K_reordered[i] = this->V_N[this->info_bits_pos[i]];
+	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+	this->d_decod_total += d_decod;
+	this->d_store_total += d_store;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_GALA_inter<B,R>
+::_store(B *V_K, const int frame_id)
+{
+	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	const auto n_frames_wave = std::min(mipp::nElReg<R>(), Decoder<B,R>::n_frames - frame_id);
+
+	std::array<B*,mipp::nElReg<R>()> frames;
+	for (auto f = 0; f < mipp::nElReg<R>(); f++)
+		frames[f] = (f < n_frames_wave) ? V_K + f * this->K : V_K_pad.data();
+	Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_K_reordered.data(), frames, this->K);
+	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+	this->d_store_total += d_store;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_GALA_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_GALA_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_GALA_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_GALA_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_GALA_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,57 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALA_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALA_INTER_HPP_
+
+#include "Module/Decoder/Decoder_SISO.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Gallager A decoder with the inter-frame SIMD strategy ('mipp::nElReg<R>()' frames per wave, the bits and the
+ * messages are stored in the 'B' type). As in Decoder_LDPC_BP_flooding_inter, the messages of a frame are frozen as
+ * soon as its syndrome is verified.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_GALA_inter : public Decoder_SISO<B,R>
+{
+protected:
+	const int                    n_ite;              // number of iterations to perform
+	const tools::Sparse_matrix  &H;                  // LDPC H matrix
+	const bool                   enable_syndrome;    // stop criterion
+	const int                    syndrome_depth;
+	const std::vector<unsigned> &info_bits_pos;
+	std::vector<int>             cur_syndrome_depth; // number of successive verified syndromes of each lane
+	mipp::vector<mipp::Reg<R>>   Y_N_reordered;      // input LLRs
+	mipp::vector<mipp::Reg<B>>   HY_N;               // input LLRs (transformed in bit)
+	mipp::vector<mipp::Reg<B>>   V_N;                // decoded bits
+	mipp::vector<mipp::Reg<B>>   C_to_V_messages;    // check    nodes to variable nodes messages
+	mipp::vector<mipp::Reg<B>>   V_to_C_messages;    // variable nodes to check    nodes messages
+	mipp::vector<mipp::Reg<B>>   V_K_reordered;      // decoded information bits
+	mipp::vector<B>              V_K_pad;            // output of the lanes without frame (last wave)
+	mipp::vector<unsigned>       transpose;
+
+public:
+	Decoder_LDPC_BP_flooding_GALA_inter(const int &K, const int &N, const int& n_ite, const tools::Sparse_matrix &H,
+	                                    const std::vector<unsigned> &info_bits_pos,
+	                                    const bool enable_syndrome = true,
+	                                    const int syndrome_depth = 1,
+	                                    const int n_frames = 1,
+	                                    const std::string name = "Decoder_LDPC_BP_flooding_GALA_inter");
+	virtual ~Decoder_LDPC_BP_flooding_GALA_inter();
+
+	using Decoder<B,R>::hard_decode_packed;
+	virtual void hard_decode_packed(const uint64_t *Y_N, B *V_K);
+
+protected:
+	void _hard_decode(const R *Y_N, B *V_K, const int frame_id);
+
+private:
+	void _decode(const int frame_id);
+	void _store (B *V_K, const int frame_id);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALA_INTER_HPP_ */
@@ -55,6 +55,11 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 	const auto &CN_to_VN = H.get_col_to_rows();
 	const auto &VN_to_CN = H.get_row_to_cols();
 
+	// first branch of each variable node
+	std::vector<int> VN_offsets(VN_to_CN.size() +1, 0);
+	for (auto i = 0; i < (int)VN_to_CN.size(); i++)
+		VN_offsets[i +1] = VN_offsets[i] + (int)VN_to_CN[i].size();
+
 	auto k = 0;
 	for (auto i = 0; i < (int)CN_to_VN.size(); i++)
 	{
@@ -62,10 +67,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		{
 			auto id_V = CN_to_VN[i][j];
 
-			auto branch_id = 0;
-			for (auto ii = 0; ii < (int)id_V; ii++)
-				branch_id += (int)VN_to_CN[ii].size();
-			branch_id += connections[id_V];
+			auto branch_id = VN_offsets[id_V] + connections[id_V];
 			connections[id_V]++;
 
 			if (connections[id_V] > (int)VN_to_CN[id_V].size())
@@ -98,6 +100,29 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		HY_N[i] = Y_N[i] < 0;
 	auto d_load = std::chrono::steady_clock::now() - t_load;
 
+	this->d_load_total += d_load;
+
+	this->_decode(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
+::_hard_decode_packed(const uint64_t *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now();  // ---------------------------------------------------------- LOAD
+	for (auto i = 0; i < this->N; i++)
+		HY_N[i] = (char)((Y_N[i >> 6] >> (i & 63)) & 1);
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	this->d_load_total += d_load;
+
+	this->_decode(V_K);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
+::_decode(B *V_K)
+{
 	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	auto cur_syndrome_depth = 0;
 	for (auto ite = 0; ite < n_ite; ite++)
@@ -188,7 +213,6 @@ void Decoder_LDPC_BP_flooding_Gallager_A<B,R>
 		V_K[i] = this->V_N[this->info_bits_pos[i]];
 	auto d_store = std::chrono::steady_clock::now() - t_store;
 
-	this->d_load_total  += d_load;
 	this->d_decod_total += d_decod;
 	this->d_store_total += d_store;
 }
@@ -33,7 +33,11 @@ public:
 	virtual ~Decoder_LDPC_BP_flooding_Gallager_A();
 
 protected:
-	void _hard_decode(const R *Y_N, B *V_K, const int frame_id);
+	void _hard_decode       (const R        *Y_N, B *V_K, const int frame_id);
+	void _hard_decode_packed(const uint64_t *Y_N, B *V_K, const int frame_id);
+
+private:
+	void _decode(B *V_K);
 };
 
 template <typename B = int, typename R = float>
@@ -0,0 +1,35 @@
+#ifndef DECODER_LDPC_BP_FLOODING_LSPA_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_LSPA_INTER_HPP_
+
+#include "../Decoder_LDPC_BP_flooding_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_LSPA_inter : public Decoder_LDPC_BP_flooding_inter<B,R>
+{
+private:
+	mipp::vector<mipp::Reg<R>> values;
+
+public:
+	Decoder_LDPC_BP_flooding_LSPA_inter(const int &K, const int &N, const int& n_ite,
+	                                     const tools::Sparse_matrix &H,
+	                                     const std::vector<unsigned> &info_bits_pos,
+	                                     const bool enable_syndrome = true,
+	                                     const int syndrome_depth = 1,
+	                                     const int n_frames = 1,
+	                                     const std::string name = "Decoder_LDPC_BP_flooding_LSPA_inter");
+	virtual ~Decoder_LDPC_BP_flooding_LSPA_inter();
+
+protected:
+	// BP functions for decoding
+	virtual mipp::Msk<mipp::N<R>()> BP_process(const mipp::Msk<mipp::N<R>()> &active,
+	                                            mipp::vector<mipp::Reg<R>> &V_to_C,
+	                                            mipp::vector<mipp::Reg<R>> &C_to_V);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_LSPA_INTER_HPP_ */
@@ -0,0 +1,176 @@
+#include <typeinfo>
+#include <limits>
+#include <cmath>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
+
+#include "Decoder_LDPC_BP_flooding_ONMS_inter.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::Decoder_LDPC_BP_flooding_ONMS_inter(const int &K, const int &N, const int& n_ite,
+                                      const Sparse_matrix &H,
+                                      const std::vector<unsigned> &info_bits_pos,
+                                      const float normalize_factor,
+                                      const R offset,
+                                      const bool enable_syndrome,
+                                      const int syndrome_depth,
+                                      const int n_frames,
+                                      const std::string name)
+: Decoder_LDPC_BP_flooding_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, name),
+  normalize_factor(normalize_factor),
+  offset          (offset),
+  saturation      ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(H.get_rows_max_degree()))) -1)),
+  normalize_id    (0)
+{
+	if (typeid(R) == typeid(signed char))
+		throw runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
+
+	if (saturation <= 0)
+	{
+		std::stringstream message;
+		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (typeid(R) == typeid(short))
+	{
+		for (auto F = 1; F <= 8; F++)
+			if (normalize_factor == (float)F * 0.125f)
+				normalize_id = F;
+
+		if (normalize_id == 0)
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+		normalize_id = (normalize_factor == 1.000f) ? 8 : 0;
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::~Decoder_LDPC_BP_flooding_ONMS_inter()
+{
+}
+
+template <typename B, typename R>
+mipp::Msk<mipp::N<R>()> Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::BP_process(const mipp::Msk<mipp::N<R>()> &active,
+             mipp::vector<mipp::Reg<R>> &V_to_C,
+             mipp::vector<mipp::Reg<R>> &C_to_V)
+{
+	switch (normalize_id)
+	{
+		case 1:  return this->_BP_process<1>(active, V_to_C, C_to_V);
+		case 2:  return this->_BP_process<2>(active, V_to_C, C_to_V);
+		case 3:  return this->_BP_process<3>(active, V_to_C, C_to_V);
+		case 4:  return this->_BP_process<4>(active, V_to_C, C_to_V);
+		case 5:  return this->_BP_process<5>(active, V_to_C, C_to_V);
+		case 6:  return this->_BP_process<6>(active, V_to_C, C_to_V);
+		case 7:  return this->_BP_process<7>(active, V_to_C, C_to_V);
+		case 8:  return this->_BP_process<8>(active, V_to_C, C_to_V);
+		default: return this->_BP_process<0>(active, V_to_C, C_to_V);
+	}
+}
+
+// offset normalized min-sum implementation
+template <typename B, typename R>
+template <int F>
+mipp::Msk<mipp::N<R>()> Decoder_LDPC_BP_flooding_ONMS_inter<B,R>
+::_BP_process(const mipp::Msk<mipp::N<R>()> &active,
+              mipp::vector<mipp::Reg<R>> &V_to_C,
+              mipp::vector<mipp::Reg<R>> &C_to_V)
+{
+	// beginning of the iteration upon all the matrix lines
+	const auto *C_to_V_ptr = C_to_V.data();
+	      auto *V_to_C_ptr = V_to_C.data();
+
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		// VN node accumulate all the incoming messages
+		const auto length = this->n_parities_per_variable[i];
+
+		auto sum_C_to_V = mipp::Reg<R>((R)0);
+		for (auto j = 0; j < length; j++)
+			sum_C_to_V += C_to_V_ptr[j];
+
+		// update the intern values
+		const auto temp = this->Y_N_reordered[i] + sum_C_to_V;
+
+		// generate the outcoming messages to the CNs
+		for (auto j = 0; j < length; j++)
+			V_to_C_ptr[j] = temp - C_to_V_ptr[j];
+
+		C_to_V_ptr += length; // jump to the next node
+		V_to_C_ptr += length; // jump to the next node
+	}
+
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+
+	auto syndrome = zero_msk;
+	auto transpose_ptr = this->transpose.data();
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto length = this->n_variables_per_parity[i];
+
+		auto sign = zero_msk;
+		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+		// accumulate the incoming information in CN
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value  = V_to_C[transpose_ptr[j]];
+			const auto v_abs  = mipp::abs(value);
+			const auto v_temp = min1;
+
+			sign ^= mipp::sign(value);
+			min1  = mipp::min(min1,           v_abs         ); // 1st min
+			min2  = mipp::min(min2, mipp::max(v_abs, v_temp)); // 2nd min
+		}
+
+		// the offset values are set to zero before the normalization (the fixed-point normalization works on the positive
+		// values)
+		const auto cste1 = simd_sat<R>(simd_normalize<R,F>(mipp::max(min2 - offset, zero), normalize_factor), saturation);
+		const auto cste2 = simd_sat<R>(simd_normalize<R,F>(mipp::max(min1 - offset, zero), normalize_factor), saturation);
+
+		// regenerate the CN outcoming values (only in the active lanes)
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value   = V_to_C[transpose_ptr[j]];
+			const auto v_abs   = mipp::abs(value);
+			const auto v_res   = mipp::blend(cste1, cste2, v_abs == min1);
+			const auto v_sig   = sign ^ mipp::sign(value);
+			const auto v_to_st = mipp::copysign(v_res, v_sig);
+
+			C_to_V[transpose_ptr[j]] = mipp::blend(v_to_st, C_to_V[transpose_ptr[j]], active);
+		}
+
+		transpose_ptr += length;
+		syndrome |= sign;
+	}
+
+	return syndrome;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_ONMS_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
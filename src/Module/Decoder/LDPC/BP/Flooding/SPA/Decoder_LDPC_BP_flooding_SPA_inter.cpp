@@ -0,0 +1,119 @@
+#include <typeinfo>
+#include <limits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
+
+#include "Decoder_LDPC_BP_flooding_SPA_inter.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_SPA_inter<B,R>
+::Decoder_LDPC_BP_flooding_SPA_inter(const int &K, const int &N, const int& n_ite,
+                                     const Sparse_matrix &H,
+                                     const std::vector<unsigned> &info_bits_pos,
+                                     const bool enable_syndrome,
+                                     const int syndrome_depth,
+                                     const int n_frames,
+                                     const std::string name)
+: Decoder_LDPC_BP_flooding_inter<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, name),
+  values(H.get_cols_max_degree())
+{
+	if (typeid(R) != typeid(float) && typeid(R) != typeid(double))
+		throw runtime_error(__FILE__, __LINE__, __func__, "This decoder only supports floating-point LLRs.");
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_SPA_inter<B,R>
+::~Decoder_LDPC_BP_flooding_SPA_inter()
+{
+}
+
+// sum-product implementation
+template <typename B, typename R>
+mipp::Msk<mipp::N<R>()> Decoder_LDPC_BP_flooding_SPA_inter<B,R>
+::BP_process(const mipp::Msk<mipp::N<R>()> &active,
+             mipp::vector<mipp::Reg<R>> &V_to_C,
+             mipp::vector<mipp::Reg<R>> &C_to_V)
+{
+	// beginning of the iteration upon all the matrix lines
+	const auto *C_to_V_ptr = C_to_V.data();
+	      auto *V_to_C_ptr = V_to_C.data();
+
+	for (auto i = 0; i < this->n_V_nodes; i++)
+	{
+		// VN node accumulate all the incoming messages
+		const auto length = this->n_parities_per_variable[i];
+
+		auto sum_C_to_V = mipp::Reg<R>((R)0);
+		for (auto j = 0; j < length; j++)
+			sum_C_to_V += C_to_V_ptr[j];
+
+		// update the intern values
+		const auto temp = this->Y_N_reordered[i] + sum_C_to_V;
+
+		// generate the outcoming messages to the CNs
+		for (auto j = 0; j < length; j++)
+			V_to_C_ptr[j] = temp - C_to_V_ptr[j];
+
+		C_to_V_ptr += length; // jump to the next node
+		V_to_C_ptr += length; // jump to the next node
+	}
+
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto one      = mipp::Reg<R>((R)1);
+	const auto max_val  = mipp::Reg<R>((R)1 - std::numeric_limits<R>::epsilon());
+
+	auto syndrome = zero_msk;
+	auto transpose_ptr = this->transpose.data();
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto length = this->n_variables_per_parity[i];
+
+		auto sign = zero_msk;
+		auto prod = one;
+
+		// accumulate the incoming information in CN
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value = V_to_C[transpose_ptr[j]];
+			const auto res   = simd_tanh_half<R>(mipp::abs(value));
+
+			sign ^= mipp::sign(value);
+			prod *= res;
+			values[j] = res;
+		}
+
+		// regenerate the CN outcoming values (only in the active lanes)
+		for (auto j = 0; j < length; j++)
+		{
+			const auto value = V_to_C[transpose_ptr[j]];
+			const auto v_sig = sign ^ mipp::sign(value);
+			      auto val   = prod / values[j];
+			           val   = mipp::blend(val, max_val, val < one); // the NaNs (0 / 0) are replaced too
+			const auto v_tan = simd_2atanh<R>(val);
+			const auto v_res = mipp::copysign(v_tan, v_sig);
+
+			C_to_V[transpose_ptr[j]] = mipp::blend(v_res, C_to_V[transpose_ptr[j]], active);
+		}
+
+		transpose_ptr += length;
+		syndrome |= sign;
+	}
+
+	return syndrome;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_SPA_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_SPA_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_SPA_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_SPA_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_SPA_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
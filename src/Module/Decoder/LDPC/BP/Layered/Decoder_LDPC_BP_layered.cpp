@@ -1,9 +1,11 @@
 #include <chrono>
 #include <limits>
 #include <cmath>
+#include <numeric>
 #include <stdexcept>
 
 #include "Tools/Math/utils.h"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
 
 #include "Decoder_LDPC_BP_layered.hpp"
 
@@ -18,6 +20,7 @@ Decoder_LDPC_BP_layered<B,R>
                           const bool enable_syndrome,
                           const int syndrome_depth,
                           const int n_frames,
+                          const bool reorder,
                           const std::string name)
 : Decoder_SISO<B,R>(K, N, n_frames, 1, name                         ),
   n_ite            (n_ite                                           ),
@@ -25,8 +28,6 @@ Decoder_LDPC_BP_layered<B,R>
   enable_syndrome  (enable_syndrome                                 ),
   syndrome_depth   (syndrome_depth                                  ),
   init_flag        (true                                            ),
-  info_bits_pos    (info_bits_pos                                   ),
-  H                (H                                               ),
   var_nodes        (n_frames, mipp::vector<R>(N                    )),
   branches         (n_frames, mipp::vector<R>(H.get_n_connections()))
 {
@@ -51,6 +52,22 @@ Decoder_LDPC_BP_layered<B,R>
 		        << H.get_n_rows() << ").";
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	if (reorder)
+	{
+		this->VN_order      = LDPC_matrix_handler::reverse_cuthill_mckee(H);
+		this->info_bits_pos = LDPC_matrix_handler::reorder_positions(info_bits_pos, this->VN_order);
+		this->H             = LDPC_matrix_handler::reorder_rows(H, this->VN_order);
+	}
+	else
+	{
+		this->VN_order.resize(N);
+		std::iota(this->VN_order.begin(), this->VN_order.end(), 0);
+		this->info_bits_pos = info_bits_pos;
+		this->H             = H;
+	}
+
+	this->syndrome = LDPC_syndrome(this->H);
 }
 
 template <typename B, typename R>
@@ -70,11 +87,13 @@ void Decoder_LDPC_BP_layered<B,R>
 	this->BP_decode(frame_id);
 
 	// prepare for next round by processing extrinsic information
+	// and copy extrinsic information into var_nodes for next TURBO iteration
 	for (auto i = 0; i < this->N; i++)
-		Y_N2[i] = this->var_nodes[frame_id][i] - Y_N1[i];
-
-	// copy extrinsic information into var_nodes for next TURBO iteration
-	std::copy(Y_N2, Y_N2 + this->N, this->var_nodes[frame_id].begin());
+	{
+		const auto v = this->VN_order[i];
+		this->var_nodes[frame_id][i] -= Y_N1[v];
+		Y_N2[v] = this->var_nodes[frame_id][i];
+	}
 }
 
 template <typename B, typename R>
@@ -92,7 +111,7 @@ void Decoder_LDPC_BP_layered<B,R>
 	}
 
 	for (auto i = 0; i < (int)var_nodes[frame_id].size(); i++)
-		this->var_nodes[frame_id][i] += Y_N[i]; // var_nodes contain previous extrinsic information
+		this->var_nodes[frame_id][i] += Y_N[this->VN_order[i]]; // var_nodes contain previous extrinsic information
 }
 
 template <typename B, typename R>
@@ -160,26 +179,7 @@ template <typename B, typename R>
 bool Decoder_LDPC_BP_layered<B,R>
 ::check_syndrome(const int frame_id)
 {
-	auto syndrome = false;
-
-	auto k = 0;
-	for (auto i = 0; i < this->n_C_nodes; i++)
-	{
-		auto sign = 0;
-
-		const auto n_VN = (int)this->H[i].size();
-		for (auto j = 0; j < n_VN; j++)
-		{
-			const auto value = this->var_nodes[frame_id][this->H[i][j]] - this->branches[frame_id][k++];
-			const auto tmp_sign  = std::signbit((float)value) ? -1 : 0;
-
-			sign ^= tmp_sign;
-		}
-
-		syndrome = syndrome || sign;
-	}
-
-	return (syndrome == 0);
+	return this->syndrome.check(this->var_nodes[frame_id].data());
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -3,6 +3,7 @@
 
 #include "../../../Decoder_SISO.hpp"
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
 
 namespace aff3ct
 {
@@ -21,9 +22,14 @@ protected:
 	// reset so C_to_V and V_to_C structures can be cleared only at the beginning of the loop in iterative decoding
 	bool init_flag;
 
-	const std::vector<unsigned> &info_bits_pos;
+	// the variable node 'i' of the decoder is the bit 'VN_order[i]' of the frame: the natural order, or the reverse
+	// Cuthill-McKee order when the variable nodes are reordered (better memory locality for the large H matrices)
+	std::vector<unsigned> VN_order;
+	std::vector<unsigned> info_bits_pos; // positions of the information bits in the order of the decoder
 
-	const tools::Sparse_matrix &H;
+	tools::Sparse_matrix H; // the H matrix with the variable nodes in the order of the decoder
+
+	tools::LDPC_syndrome syndrome; // parity checks of the hard decisions of 'var_nodes'
 
 	// data structures for iterative decoding
 	std::vector<mipp::vector<R>> var_nodes;
@@ -36,6 +42,7 @@ public:
 	                        const bool enable_syndrome = true,
 	                        const int syndrome_depth = 1,
 	                        const int n_frames = 1,
+	                        const bool reorder = false,
 	                        const std::string name = "Decoder_LDPC_BP_layered");
 	virtual ~Decoder_LDPC_BP_layered();
 
@@ -51,6 +58,7 @@ protected:
 	// BP functions for decoding
 	void BP_decode(const int frame_id);
 
+	// true when the hard decisions of the a posteriori values verify all the parity checks
 	bool check_syndrome(const int frame_id);
 
 	virtual void BP_process(mipp::vector<R> &var_nodes, mipp::vector<R> &branches) = 0;
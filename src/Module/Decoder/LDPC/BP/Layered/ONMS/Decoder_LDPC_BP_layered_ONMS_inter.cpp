@@ -1,17 +1,53 @@
 #include <limits>
 #include <cmath>
+#include <numeric>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
 
 #include "Tools/Math/utils.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
 
 #include "Decoder_LDPC_BP_layered_ONMS_inter.hpp"
 
 using namespace aff3ct::module;
 using namespace aff3ct::tools;
 
+// largest value of the symmetric range of a signed 'n_bits' fixed-point value (no saturation in floating-point)
+template <typename R>
+inline R saturation_value(const int n_bits)
+{
+	return (R)((1 << (n_bits -1)) -1);
+}
+
+template <>
+inline float saturation_value(const int n_bits)
+{
+	return std::numeric_limits<float>::max();
+}
+
+template <>
+inline double saturation_value(const int n_bits)
+{
+	return std::numeric_limits<double>::max();
+}
+
+// number of registers of the compressed messages: for each check node, the two output magnitudes, the index of the
+// smallest incoming magnitude and the words of sign bits (one bit per branch in the words of B)
+template <typename B>
+inline int n_compressed_messages(const Sparse_matrix &H)
+{
+	const auto n_bits = (int)sizeof(B) * 8;
+
+	auto n_messages = 0;
+	for (unsigned i = 0; i < H.get_n_cols(); i++)
+		n_messages += 3 + ((int)H[i].size() + n_bits -1) / n_bits;
+	return n_messages;
+}
+
 template <typename B, typename R>
 Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::Decoder_LDPC_BP_layered_ONMS_inter(const int &K, const int &N, const int& n_ite,
@@ -22,21 +58,33 @@ Decoder_LDPC_BP_layered_ONMS_inter<B,R>
                                      const bool enable_syndrome,
                                      const int syndrome_depth,
                                      const int n_frames,
+                                     const bool reorder,
+                                     const int n_bits_msg,
+                                     const int n_bits_app,
+                                     const bool compress,
                                      const std::string name)
 : Decoder_SISO<B,R>(K, N, n_frames, mipp::nElReg<R>(), name                                      ),
   normalize_factor (normalize_factor                                                             ),
   offset           (offset                                                                       ),
+  normalize_id     (0                                                                            ),
   contributions    (H.get_cols_max_degree()                                                      ),
-  saturation       ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(H.get_rows_max_degree()))) -1)),
+  lane_busy        (mipp::nElReg<R>(), false                                                     ),
+  lane_frame_id    (mipp::nElReg<R>(), 0                                                         ),
+  lane_ite         (mipp::nElReg<R>(), 0                                                         ),
+  lane_depth       (mipp::nElReg<R>(), 0                                                         ),
+  n_bits_app       (n_bits_app ? n_bits_app : (int)sizeof(R) * 8                                 ),
+  n_bits_msg       (n_bits_msg ? n_bits_msg : this->n_bits_app -2                                ),
+  app_saturation   (saturation_value<R>(this->n_bits_app)                                        ),
+  saturation       (saturation_value<R>(this->n_bits_msg)                                        ),
   n_ite            (n_ite                                                                        ),
   n_C_nodes        ((int)H.get_n_cols()                                                          ),
   enable_syndrome  (enable_syndrome                                                              ),
   syndrome_depth   (syndrome_depth                                                               ),
+  compress         (compress                                                                     ),
+  n_messages       (compress ? n_compressed_messages<B>(H) : (int)H.get_n_connections()          ),
   init_flag        (true                                                                         ),
-  info_bits_pos    (info_bits_pos                                                                ),
-  H                (H                                                                            ),
   var_nodes        (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(N)                             ),
-  branches         (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(H.get_n_connections())         ),
+  branches         (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->n_messages)              ),
   Y_N_reorderered  (N                                                                            ),
   V_K_reorderered  (K                                                                            )
 {
@@ -62,14 +110,59 @@ Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (typeid(R) == typeid(signed char))
-		throw runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
+	if (this->n_bits_app < 2 || this->n_bits_app > (int)sizeof(R) * 8)
+	{
+		std::stringstream message;
+		message << "'n_bits_app' has to be in [2, " << sizeof(R) * 8 << "] ('n_bits_app' = " << this->n_bits_app << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->n_bits_msg < 2 || this->n_bits_msg > this->n_bits_app)
+	{
+		std::stringstream message;
+		message << "'n_bits_msg' has to be in [2, 'n_bits_app'] ('n_bits_msg' = " << this->n_bits_msg
+		        << ", 'n_bits_app' = " << this->n_bits_app << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
-	if (saturation <= 0)
+	// the index of the smallest incoming magnitude is stored in a register of R
+	if (compress && (double)H.get_cols_max_degree() > (double)std::numeric_limits<R>::max())
 	{
 		std::stringstream message;
-		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
-		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		message << "The degree of the check nodes is too high to compress the messages with this type of LLRs "
+		        << "('H.get_cols_max_degree()' = " << H.get_cols_max_degree() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
+	{
+		for (auto F = 1; F <= 8; F++)
+			if (normalize_factor == (float)F * 0.125f)
+				normalize_id = F;
+
+		if (normalize_id == 0)
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+		normalize_id = (normalize_factor == 1.000f) ? 8 : 0;
+
+	if (reorder)
+	{
+		this->VN_order      = LDPC_matrix_handler::reverse_cuthill_mckee(H);
+		this->info_bits_pos = LDPC_matrix_handler::reorder_positions(info_bits_pos, this->VN_order);
+		this->H             = LDPC_matrix_handler::reorder_rows(H, this->VN_order);
+	}
+	else
+	{
+		this->VN_order.resize(N);
+		std::iota(this->VN_order.begin(), this->VN_order.end(), 0);
+		this->info_bits_pos = info_bits_pos;
+		this->H             = H;
 	}
 }
 
@@ -87,38 +180,22 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	this->_load(Y_N1, frame_id);
 
 	// actual decoding
-	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
-	{
-		     if (normalize_factor == 0.125f) this->BP_decode<1>(frame_id);
-		else if (normalize_factor == 0.250f) this->BP_decode<2>(frame_id);
-		else if (normalize_factor == 0.375f) this->BP_decode<3>(frame_id);
-		else if (normalize_factor == 0.500f) this->BP_decode<4>(frame_id);
-		else if (normalize_factor == 0.625f) this->BP_decode<5>(frame_id);
-		else if (normalize_factor == 0.750f) this->BP_decode<6>(frame_id);
-		else if (normalize_factor == 0.875f) this->BP_decode<7>(frame_id);
-		else if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
-		else
-		{
-			std::stringstream message;
-			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
-			        << " ('normalize_factor' = " << normalize_factor << ").";
-			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-		}
-	}
-	else // float or double
-	{
-		if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
-		else                            this->BP_decode<0>(frame_id);
-	}
+	this->BP_decode(frame_id);
 
 	// prepare for next round by processing extrinsic information
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
+	// (back in the natural order of the variable nodes in 'Y_N_reorderered')
 	for (auto i = 0; i < this->N; i++)
-		this->var_nodes[cur_wave][i] -= Y_N_reorderered[i];
+	{
+		const auto v = this->VN_order[i];
+		this->var_nodes[cur_wave][i] = simd_sat<R>(simd_subs<R>(this->var_nodes[cur_wave][i], Y_N_reorderered[v]),
+		                                           app_saturation);
+		Y_N_reorderered[v] = this->var_nodes[cur_wave][i];
+	}
 
-	std::vector<R*> frames(mipp::nElReg<R>());
+	std::array<R*,mipp::nElReg<R>()> frames;
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N2 + f * this->N;
-	Reorderer_static<R,mipp::nElReg<R>()>::apply_rev((R*)this->var_nodes[cur_wave].data(), frames, this->N);
+	Reorderer_static<R,mipp::nElReg<R>()>::apply_rev((R*)this->Y_N_reorderered.data(), frames, this->N);
 }
 
 template <typename B, typename R>
@@ -137,12 +214,15 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		if (cur_wave == this->n_dec_waves -1) this->init_flag = false;
 	}
 
-	std::vector<const R*> frames(mipp::nElReg<R>());
+	std::array<const R*,mipp::nElReg<R>()> frames;
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = Y_N + f * this->N;
 	Reorderer_static<R,mipp::nElReg<R>()>::apply(frames, (R*)this->Y_N_reorderered.data(), this->N);
 
+	// var_nodes contain previous extrinsic information
 	for (auto i = 0; i < (int)var_nodes[cur_wave].size(); i++)
-		this->var_nodes[cur_wave][i] += this->Y_N_reorderered[i]; // var_nodes contain previous extrinsic information
+		this->var_nodes[cur_wave][i] = simd_sat<R>(simd_adds<R>(this->var_nodes[cur_wave][i],
+		                                                        this->Y_N_reorderered[this->VN_order[i]]),
+		                                           app_saturation);
 }
 
 template <typename B, typename R>
@@ -155,29 +235,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 
 	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
 	// actual decoding
-	if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
-	{
-		     if (normalize_factor == 0.125f) this->BP_decode<1>(frame_id);
-		else if (normalize_factor == 0.250f) this->BP_decode<2>(frame_id);
-		else if (normalize_factor == 0.375f) this->BP_decode<3>(frame_id);
-		else if (normalize_factor == 0.500f) this->BP_decode<4>(frame_id);
-		else if (normalize_factor == 0.625f) this->BP_decode<5>(frame_id);
-		else if (normalize_factor == 0.750f) this->BP_decode<6>(frame_id);
-		else if (normalize_factor == 0.875f) this->BP_decode<7>(frame_id);
-		else if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
-		else
-		{
-			std::stringstream message;
-			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
-			        << " ('normalize_factor' = " << normalize_factor << ").";
-			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-		}
-	}
-	else // float or double
-	{
-		if (normalize_factor == 1.000f) this->BP_decode<8>(frame_id);
-		else                            this->BP_decode<0>(frame_id);
-	}
+	this->BP_decode(frame_id);
 
 	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
@@ -204,7 +262,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		V_K_reorderered[i] = mipp::cast<R,B>(this->var_nodes[cur_wave][k]) >> (sizeof(B) * 8 - 1);
 	}
 
-	std::vector<B*> frames(mipp::nElReg<R>());
+	std::array<B*,mipp::nElReg<R>()> frames;
 	for (auto f = 0; f < mipp::nElReg<R>(); f++) frames[f] = V_K + f * this->K;
 	Reorderer_static<B,mipp::nElReg<R>()>::apply_rev((B*)V_K_reorderered.data(), frames, this->K);
 
@@ -212,9 +270,114 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 	if (cur_wave == this->n_dec_waves -1) this->init_flag = true;
 }
 
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::push_frame(const R *Y_N, const uint64_t frame_id)
+{
+	// the streaming data structures are allocated at the first use only (they are not needed by the waves decoding)
+	if (this->stream_var_nodes.empty())
+	{
+		const auto zero = mipp::Reg<R>((R)0);
+		this->stream_var_nodes.resize(this->N,                     zero);
+		this->stream_branches .resize(this->n_messages,            zero);
+	}
+
+	this->stream_in.push_back(std::make_pair(frame_id, std::vector<R>(Y_N, Y_N + this->N)));
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::pull_frame(B *V_K, uint64_t &frame_id)
+{
+	auto is_busy = [&]() { return std::find(lane_busy.begin(), lane_busy.end(), true) != lane_busy.end(); };
+
+	while (this->stream_out.empty() && (!this->stream_in.empty() || is_busy()))
+		this->stream_step();
+
+	if (this->stream_out.empty())
+		return false;
+
+	frame_id = this->stream_out.front().first;
+	std::copy(this->stream_out.front().second.begin(), this->stream_out.front().second.end(), V_K);
+	this->stream_out.pop_front();
+
+	return true;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::stream_step()
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+	const auto n_branches = (int)this->stream_branches.size();
+
+	auto *var_nodes = (R*)this->stream_var_nodes.data();
+	auto *branches  = (R*)this->stream_branches .data();
+
+	// refill the free lanes with the next frames
+	auto n_busy = 0;
+	for (auto l = 0; l < n_lanes; l++)
+	{
+		if (!this->lane_busy[l] && !this->stream_in.empty())
+		{
+			const auto &Y_N = this->stream_in.front().second;
+			for (auto i = 0; i < this->N; i++)
+			{
+				const auto y = Y_N[this->VN_order[i]];
+				var_nodes[i * n_lanes + l] = std::max(std::min(y, app_saturation), (R)-app_saturation);
+			}
+			for (auto k = 0; k < n_branches; k++)
+				branches[k * n_lanes + l] = (R)0;
+
+			this->lane_frame_id[l] = this->stream_in.front().first;
+			this->lane_ite     [l] = 0;
+			this->lane_depth   [l] = 0;
+			this->lane_busy    [l] = true;
+			this->stream_in.pop_front();
+		}
+		n_busy += this->lane_busy[l] ? 1 : 0;
+	}
+
+	if (n_busy == 0)
+		return;
+
+	// one iteration for all the lanes (the results of the free lanes are ignored)
+	this->BP_process(this->stream_var_nodes, this->stream_branches);
+
+	auto syndrome = mipp::Msk<mipp::N<R>()>(true);
+	if (this->enable_syndrome)
+		syndrome = this->check_syndrome_lanes(this->stream_var_nodes);
+
+	// stop criterion (lane by lane)
+	for (auto l = 0; l < n_lanes; l++)
+	{
+		if (!this->lane_busy[l])
+			continue;
+
+		this->lane_ite[l]++;
+		if (this->enable_syndrome)
+			this->lane_depth[l] = syndrome[l] ? 0 : this->lane_depth[l] +1;
+
+		if ((this->enable_syndrome && this->lane_depth[l] == this->syndrome_depth) ||
+		    this->lane_ite[l] == this->n_ite)
+		{
+			// take the hard decision (as in '_store')
+			std::vector<B> V_K(this->K);
+			for (auto i = 0; i < this->K; i++)
+			{
+				const auto k = this->info_bits_pos[i];
+				const auto decision = mipp::cast<R,B>(this->stream_var_nodes[k]) >> (sizeof(B) * 8 - 1);
+				V_K[i] = decision[l];
+			}
+			this->stream_out.push_back(std::make_pair(this->lane_frame_id[l], std::move(V_K)));
+
+			this->lane_busy[l] = false;
+		}
+	}
+}
+
 // BP algorithm
 template <typename B, typename R>
-template <int F>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::BP_decode(const int frame_id)
 {
@@ -224,7 +387,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
-		this->BP_process<F>(this->var_nodes[cur_wave], this->branches[cur_wave]);
+		this->BP_process(this->var_nodes[cur_wave], this->branches[cur_wave]);
 
 		// stop criterion
 		if (this->enable_syndrome && this->check_syndrome(frame_id))
@@ -243,68 +406,69 @@ bool Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 ::check_syndrome(const int frame_id)
 {
 	const auto cur_wave = frame_id / this->simd_inter_frame_level;
-	const auto zero = mipp::Msk<mipp::N<B>()>(false);
+	const auto syndrome = this->check_syndrome_lanes(this->var_nodes[cur_wave]);
+
+	auto i = 0;
+	while (i < mipp::nElReg<B>() && !syndrome[i]) i++;
+	return (i == mipp::nElReg<B>());
+}
+
+template <typename B, typename R>
+mipp::Msk<mipp::N<R>()> Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::check_syndrome_lanes(const mipp::vector<mipp::Reg<R>> &var_nodes)
+{
+	const auto zero = mipp::Msk<mipp::N<R>()>(false);
 	auto syndrome = zero;
 
-	auto k = 0;
 	for (auto i = 0; i < this->n_C_nodes; i++)
 	{
 		auto sign = zero;
-
-		const auto n_VN = (int)this->H[i].size();
-		for (auto j = 0; j < n_VN; j++)
-		{
-			const auto value = this->var_nodes[cur_wave][this->H[i][j]] - this->branches[cur_wave][k++];
-			sign ^= mipp::sign(value);
-		}
+		for (const auto v : this->H[i])
+			sign ^= mipp::sign(var_nodes[v]);
 
 		syndrome |= sign;
 	}
 
-	auto i = 0;
-	while (i < mipp::nElReg<B>() && !syndrome[i]) i++;
-	return (i == mipp::nElReg<B>());
+	return syndrome;
 }
 
-// --------------------------------------------------------------------------------------------------------------------
-// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
-
-//                                                                                                           saturation
-template <typename R>
-inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
-{
-	return val;
-}
-template <>
-inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
-{
-	return mipp::sat(v, (short)-s, (short)+s);
-}
-
-//                                                                                                        normalization
-template <typename R, int F = 0> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches)
 {
-	return val * mipp::Reg<R>((R)factor);
+	if (this->compress)
+		switch (normalize_id)
+		{
+			case 1:  this->_BP_process_compressed<1>(var_nodes, branches); break;
+			case 2:  this->_BP_process_compressed<2>(var_nodes, branches); break;
+			case 3:  this->_BP_process_compressed<3>(var_nodes, branches); break;
+			case 4:  this->_BP_process_compressed<4>(var_nodes, branches); break;
+			case 5:  this->_BP_process_compressed<5>(var_nodes, branches); break;
+			case 6:  this->_BP_process_compressed<6>(var_nodes, branches); break;
+			case 7:  this->_BP_process_compressed<7>(var_nodes, branches); break;
+			case 8:  this->_BP_process_compressed<8>(var_nodes, branches); break;
+			default: this->_BP_process_compressed<0>(var_nodes, branches); break;
+		}
+	else
+		switch (normalize_id)
+		{
+			case 1:  this->_BP_process<1>(var_nodes, branches); break;
+			case 2:  this->_BP_process<2>(var_nodes, branches); break;
+			case 3:  this->_BP_process<3>(var_nodes, branches); break;
+			case 4:  this->_BP_process<4>(var_nodes, branches); break;
+			case 5:  this->_BP_process<5>(var_nodes, branches); break;
+			case 6:  this->_BP_process<6>(var_nodes, branches); break;
+			case 7:  this->_BP_process<7>(var_nodes, branches); break;
+			case 8:  this->_BP_process<8>(var_nodes, branches); break;
+			default: this->_BP_process<0>(var_nodes, branches); break;
+		}
 }
-template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
-template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
-template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
-template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
-template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
-template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
-template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
-template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
-template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
-template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
-
-// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
-// --------------------------------------------------------------------------------------------------------------------
 
 // BP algorithm
 template <typename B, typename R>
 template <int F>
 void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
-::BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches)
+::_BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches)
 {
 	auto kr = 0;
 	auto kw = 0;
@@ -320,7 +484,7 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 		const auto n_VN = (int)this->H[i].size();
 		for (auto j = 0; j < n_VN; j++)
 		{
-			contributions[j]  = var_nodes[this->H[i][j]] - branches[kr++];
+			contributions[j]  = simd_sat<R>(simd_subs<R>(var_nodes[this->H[i][j]], branches[kr++]), app_saturation);
 			const auto v_abs  = mipp::abs (contributions[j]);
 			const auto c_sign = mipp::sign(contributions[j]);
 			const auto v_temp = min1;
@@ -330,11 +494,13 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			min2  = mipp::min(min2, mipp::max(v_abs, v_temp));
 		}
 
-		auto cste1 = simd_sat<R>(simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
-		auto cste2 = simd_sat<R>(simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
-
-		cste1 = mipp::blend(zero, cste1, zero > cste1);
-		cste2 = mipp::blend(zero, cste2, zero > cste2);
+		// the offset values are set to zero before the normalization (the fixed-point normalization works on the positive
+		// values)
+		const auto off   = mipp::Reg<R>(offset);
+		const auto cste1 = simd_sat<R>(simd_normalize<R,F>(mipp::max(simd_subs<R>(min2, off), zero), normalize_factor),
+		                               saturation);
+		const auto cste2 = simd_sat<R>(simd_normalize<R,F>(mipp::max(simd_subs<R>(min1, off), zero), normalize_factor),
+		                               saturation);
 
 		for (auto j = 0; j < n_VN; j++)
 		{
@@ -345,11 +511,93 @@ void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
 			           v_res = mipp::copysign(v_res, v_sig);
 
 			branches[kw++] = v_res;
-			var_nodes[this->H[i][j]] = contributions[j] + v_res;
+			var_nodes[this->H[i][j]] = simd_sat<R>(simd_adds<R>(contributions[j], v_res), app_saturation);
 		}
 	}
 }
 
+// BP algorithm with the compressed messages
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_inter<B,R>
+::_BP_process_compressed(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &messages)
+{
+	constexpr auto n_bits = (int)sizeof(B) * 8;
+
+	auto k = 0;
+
+	const auto zero_msk = mipp::Msk<mipp::N<B>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+	const auto zero_b   = mipp::Reg<B>((B)0);
+	for (auto i = 0; i < this->n_C_nodes; i++)
+	{
+		const auto n_VN    = (int)this->H[i].size();
+		const auto n_words = (n_VN + n_bits -1) / n_bits;
+
+		// the messages of the previous iteration: the output magnitude of the smallest incoming magnitude
+		// ('msg_cste1'), the output magnitude of the others ('msg_cste2'), the index of the smallest incoming magnitude
+		// ('msg_idx') and the sign of the message 'j' in the bit 'j % n_bits' of the word 'j / n_bits' ('msg_signs')
+		auto &msg_cste1 = messages[k +0];
+		auto &msg_cste2 = messages[k +1];
+		auto &msg_idx   = messages[k +2];
+		auto *msg_signs = &messages[k +3];
+
+		auto sign = zero_msk;
+		auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto idx  = zero;
+
+		for (auto j = 0; j < n_VN; j++)
+		{
+			const auto r_j    = mipp::Reg<R>((R)j);
+			const auto w_sign = mipp::cast<R,B>(msg_signs[j / n_bits]) << (n_bits -1 - j % n_bits);
+			const auto branch = mipp::copysign(mipp::blend(msg_cste1, msg_cste2, msg_idx == r_j), mipp::sign(w_sign));
+
+			contributions[j]  = simd_sat<R>(simd_subs<R>(var_nodes[this->H[i][j]], branch), app_saturation);
+			const auto v_abs  = mipp::abs (contributions[j]);
+			const auto c_sign = mipp::sign(contributions[j]);
+			const auto v_temp = min1;
+
+			sign ^= c_sign;
+			idx   = mipp::blend(r_j, idx, v_abs < min1);
+			min1  = mipp::min(min1,           v_abs         );
+			min2  = mipp::min(min2, mipp::max(v_abs, v_temp));
+		}
+
+		// the offset values are set to zero before the normalization (the fixed-point normalization works on the positive
+		// values)
+		const auto off   = mipp::Reg<R>(offset);
+		const auto cste1 = simd_sat<R>(simd_normalize<R,F>(mipp::max(simd_subs<R>(min2, off), zero), normalize_factor),
+		                               saturation);
+		const auto cste2 = simd_sat<R>(simd_normalize<R,F>(mipp::max(simd_subs<R>(min1, off), zero), normalize_factor),
+		                               saturation);
+
+		// when several incoming magnitudes are the smallest, 'min1' = 'min2' and the index does not matter
+		msg_cste1 = cste1;
+		msg_cste2 = cste2;
+		msg_idx   = idx;
+
+		for (auto w = 0; w < n_words; w++)
+		{
+			auto word = zero_b;
+			for (auto j = w * n_bits; j < std::min((w +1) * n_bits, n_VN); j++)
+			{
+				const auto value = contributions[j];
+				const auto v_abs = mipp::abs(value);
+				      auto v_res = mipp::blend(cste1, cste2, v_abs == min1);
+				const auto v_sig = sign ^ mipp::sign(value);
+				           v_res = mipp::copysign(v_res, v_sig);
+
+				word |= mipp::blend(mipp::Reg<B>((B)((uint64_t)1 << (j % n_bits))), zero_b, v_sig);
+				var_nodes[this->H[i][j]] = simd_sat<R>(simd_adds<R>(contributions[j], v_res), app_saturation);
+			}
+			msg_signs[w] = mipp::cast<B,R>(word);
+		}
+
+		k += 3 + n_words;
+	}
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -1,6 +1,10 @@
 #ifndef DECODER_LDPC_BP_LAYERED_ONMS_INTER_HPP_
 #define DECODER_LDPC_BP_LAYERED_ONMS_INTER_HPP_
 
+#include <deque>
+#include <vector>
+#include <utility>
+
 #include "../../../../Decoder_SISO.hpp"
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
 
@@ -13,23 +17,52 @@ class Decoder_LDPC_BP_layered_ONMS_inter : public Decoder_SISO<B,R>
 {
 private:
 	const float normalize_factor;
-	const R offset;
+	const R     offset;
+	int         normalize_id; // 'normalize_factor' * 8 when the normalization is made with shifts, 0 otherwise
 	mipp::vector<mipp::Reg<R>> contributions;
 
+	// streaming decoding (push_frame/pull_frame): each SIMD lane decodes a frame of the input queue until its own stop
+	// criterion and is then refilled with the next frame, the decoded frames wait in the output queue
+	std::deque<std::pair<uint64_t,std::vector<R>>> stream_in;
+	std::deque<std::pair<uint64_t,std::vector<B>>> stream_out;
+	std::vector<bool>                              lane_busy;
+	std::vector<uint64_t>                          lane_frame_id;
+	std::vector<int>                               lane_ite;
+	std::vector<int>                               lane_depth;
+	mipp::vector<mipp::Reg<R>>                     stream_var_nodes;
+	mipp::vector<mipp::Reg<R>>                     stream_branches;
+
 protected:
-	const R saturation;
+	// fixed-point saturation: the a posteriori values (APP) are saturated on 'n_bits_app' bits and the check nodes to
+	// variable nodes messages on 'n_bits_msg' bits, in the symmetric range [-(2^(n_bits -1) -1), 2^(n_bits -1) -1]
+	// (by default, all the bits of R for the APP and 2 bits less for the messages)
+	const int n_bits_app;
+	const int n_bits_msg;
+	const R   app_saturation;
+	const R   saturation;
+
 	const int n_ite;     // number of iterations to perform
 	const int n_C_nodes; // number of check nodes (= N - K)
 
 	const bool enable_syndrome;
 	const int  syndrome_depth;
 
+	// compressed storage of the check nodes to variable nodes messages: instead of one message per branch, each check
+	// node keeps its two output magnitudes (computed from the two smallest incoming magnitudes), the index of the
+	// smallest incoming magnitude and one sign bit per branch (packed in words of 'sizeof(B) * 8' bits), the messages
+	// are rebuilt on the fly at the next iteration
+	const bool compress;
+	const int  n_messages; // number of registers of the messages per wave
+
 	// reset so C_to_V and V_to_C structures can be cleared only at the beginning of the loop in iterative decoding
 	bool init_flag;
 
-	const std::vector<unsigned> &info_bits_pos;
+	// the variable node 'i' of the decoder is the bit 'VN_order[i]' of the frame: the natural order, or the reverse
+	// Cuthill-McKee order when the variable nodes are reordered (better memory locality for the large H matrices)
+	std::vector<unsigned> VN_order;
+	std::vector<unsigned> info_bits_pos; // positions of the information bits in the order of the decoder
 
-	const tools::Sparse_matrix &H;
+	tools::Sparse_matrix H; // the H matrix with the variable nodes in the order of the decoder
 
 	// data structures for iterative decoding
 	std::vector<mipp::vector<mipp::Reg<R>>> var_nodes;
@@ -47,9 +80,16 @@ public:
 	                                   const bool enable_syndrome = true,
 	                                   const int syndrome_depth = 1,
 	                                   const int n_frames = 1,
+	                                   const bool reorder = false,
+	                                   const int n_bits_msg = 0,
+	                                   const int n_bits_app = 0,
+	                                   const bool compress = false,
 	                                   const std::string name = "Decoder_LDPC_BP_layered_ONMS_inter");
 	virtual ~Decoder_LDPC_BP_layered_ONMS_inter();
 
+	void push_frame(const R *Y_N, const uint64_t frame_id);
+	bool pull_frame(B *V_K, uint64_t &frame_id);
+
 protected:
 	// soft decode
 	void _soft_decode(const R *Y_N1, R *Y_N2, const int frame_id);
@@ -60,13 +100,24 @@ protected:
 	void _store      (              B *V_K, const int frame_id);
 
 	// BP functions for decoding
-	template <int F = 1>
 	void BP_decode(const int frame_id);
 
 	bool check_syndrome(const int frame_id);
 
-	template <int F = 1>
+	// the lanes for which the hard decisions of the a posteriori values do not verify all the parity checks
+	mipp::Msk<mipp::N<R>()> check_syndrome_lanes(const mipp::vector<mipp::Reg<R>> &var_nodes);
+
 	void BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
+
+	template <int F = 1>
+	void _BP_process(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
+
+	template <int F = 1>
+	void _BP_process_compressed(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &messages);
+
+private:
+	// one iteration of the streaming decoding (refill the free lanes, decode, retire the decoded frames)
+	void stream_step();
 };
 }
 }
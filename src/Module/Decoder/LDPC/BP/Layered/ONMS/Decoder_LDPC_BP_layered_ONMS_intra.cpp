@@ -0,0 +1,481 @@
+#include <chrono>
+#include <limits>
+#include <cmath>
+#include <sstream>
+#include <typeinfo>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/QC/LDPC_QC.hpp"
+#include "Tools/Code/LDPC/decoder_LDPC_functions.h"
+
+#include "Decoder_LDPC_BP_layered_ONMS_intra.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::Decoder_LDPC_BP_layered_ONMS_intra(const int &K, const int &N, const int& n_ite,
+                                     const Sparse_matrix &H,
+                                     const std::vector<unsigned> &info_bits_pos,
+                                     const float normalize_factor,
+                                     const R offset,
+                                     const bool enable_syndrome,
+                                     const int syndrome_depth,
+                                     const int n_frames,
+                                     const int n_threads,
+                                     const std::string name)
+: Decoder_SISO<B,R>(K, N, n_frames, 1, name                                                      ),
+  normalize_factor (normalize_factor                                                             ),
+  offset           (offset                                                                       ),
+  saturation       ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(H.get_rows_max_degree()))) -1)),
+  normalize_id     (0                                                                            ),
+  n_ite            (n_ite                                                                        ),
+  n_C_nodes        ((int)H.get_n_cols()                                                          ),
+  enable_syndrome  (enable_syndrome                                                              ),
+  syndrome_depth   (syndrome_depth                                                               ),
+  init_flag        (true                                                                         ),
+  info_bits_pos    (info_bits_pos                                                                ),
+  n_threads        (n_threads                                                                    ),
+  team_barrier     (std::max(n_threads, 1)                                                       ),
+  team_job         (0                                                                            ),
+  team_frame_id    (0                                                                            ),
+  team_stop        (false                                                                        ),
+  team_syndrome    (false                                                                        )
+{
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << H.get_n_rows() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (typeid(R) == typeid(signed char))
+		throw runtime_error(__FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
+
+	if (saturation <= 0)
+	{
+		std::stringstream message;
+		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (typeid(R) == typeid(short))
+	{
+		for (auto F = 1; F <= 8; F++)
+			if (normalize_factor == (float)F * 0.125f)
+				normalize_id = F;
+
+		if (normalize_id == 0)
+		{
+			std::stringstream message;
+			message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+			        << " ('normalize_factor' = " << normalize_factor << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+	else // float or double
+		normalize_id = (normalize_factor == 1.000f) ? 8 : 0;
+
+	const auto QC = LDPC_QC::detect(H);
+
+	this->Z            = (int)QC.get_Z();
+	this->n_block_cols = (int)QC.get_n_block_cols();
+	this->Z_pad        = ((this->Z + mipp::nElReg<R>() -1) / mipp::nElReg<R>()) * mipp::nElReg<R>();
+	this->Z_ext        = this->Z + mipp::nElReg<R>() -1;
+
+	auto max_layer_degree = 0;
+	this->layer_offsets.push_back(0);
+	for (unsigned r = 0; r < QC.get_n_block_rows(); r++)
+	{
+		for (unsigned c = 0; c < QC.get_n_block_cols(); c++)
+			if (QC.get_shift(r, c) >= 0)
+			{
+				this->block_cols  .push_back(c);
+				this->block_shifts.push_back(QC.get_shift(r, c));
+			}
+
+		this->layer_offsets.push_back((unsigned)this->block_cols.size());
+		max_layer_degree = std::max(max_layer_degree, (int)(this->layer_offsets[r +1] - this->layer_offsets[r]));
+	}
+
+	this->var_nodes    .resize(n_frames, mipp::vector<R>(this->n_block_cols       * this->Z_ext));
+	this->branches     .resize(n_frames, mipp::vector<R>(this->block_cols.size() * this->Z_pad));
+	this->contributions.resize(max_layer_degree * this->Z_pad);
+
+	for (auto t = 1; t < n_threads; t++)
+		this->team.push_back(std::thread(&Decoder_LDPC_BP_layered_ONMS_intra<B,R>::team_loop, this, t));
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::~Decoder_LDPC_BP_layered_ONMS_intra()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->team_mutex);
+		this->team_stop = true;
+	}
+	this->team_cond.notify_all();
+
+	for (auto &thread : this->team)
+		thread.join();
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::team_loop(const int tid)
+{
+	auto job      = 0;
+	auto frame_id = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(this->team_mutex);
+			this->team_cond.wait(lock, [&]() { return this->team_job != job || this->team_stop; });
+
+			if (this->team_stop)
+				return;
+			job      = this->team_job;
+			frame_id = this->team_frame_id;
+		}
+
+		this->BP_decode_team(frame_id, tid);
+	}
+}
+
+template <typename B, typename R>
+int Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::VN_pos(const int v) const
+{
+	return (v / this->Z) * this->Z_ext + v % this->Z;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::update_copy(R *block_col) const
+{
+	for (auto i = this->Z; i < this->Z_ext; i++)
+		block_col[i] = block_col[i % this->Z];
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_soft_decode(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	this->_load(Y_N1, frame_id);
+
+	// actual decoding
+	this->BP_decode(frame_id);
+
+	// prepare for next round by processing extrinsic information
+	// and copy extrinsic information into var_nodes for next TURBO iteration
+	for (auto v = 0; v < this->N; v++)
+	{
+		const auto k = this->VN_pos(v);
+		this->var_nodes[frame_id][k] -= Y_N1[v];
+		Y_N2[v] = this->var_nodes[frame_id][k];
+	}
+
+	for (auto c = 0; c < this->n_block_cols; c++)
+		this->update_copy(this->var_nodes[frame_id].data() + c * this->Z_ext);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_load(const R *Y_N, const int frame_id)
+{
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->branches [frame_id].begin(), this->branches [frame_id].end(), (R)0);
+		std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+
+	// var_nodes contain previous extrinsic information
+	for (auto c = 0; c < this->n_block_cols; c++)
+	{
+		auto block_col = this->var_nodes[frame_id].data() + c * this->Z_ext;
+		for (auto i = 0; i < this->Z; i++)
+			block_col[i] += Y_N[c * this->Z + i];
+
+		this->update_copy(block_col);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_hard_decode(const R *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N, frame_id);
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	// actual decoding
+	this->BP_decode(frame_id);
+	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	// set the flag so the branches can be reset to 0 only at the beginning of the loop in iterative decoding
+	if (frame_id == Decoder<B,R>::n_frames -1)
+		this->init_flag = true;
+
+	this->_store(V_K, frame_id);
+	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+	this->d_load_total  += d_load;
+	this->d_decod_total += d_decod;
+	this->d_store_total += d_store;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::_store(B *V_K, const int frame_id) const
+{
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->VN_pos(this->info_bits_pos[i]);
+		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
+	}
+}
+
+// BP algorithm
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_decode(const int frame_id)
+{
+	if (this->n_threads > 1)
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->team_mutex);
+			this->team_frame_id = frame_id;
+			this->team_job++;
+		}
+		this->team_cond.notify_all();
+	}
+
+	// the calling thread is the thread 0 of the team
+	this->BP_decode_team(frame_id, 0);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_decode_team(const int frame_id, const int tid)
+{
+	auto cur_syndrome_depth = 0;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		auto &var_nodes = this->var_nodes[frame_id];
+		auto &branches  = this->branches [frame_id];
+
+		switch (normalize_id)
+		{
+			case 1:  this->BP_process<1>(var_nodes, branches, tid); break;
+			case 2:  this->BP_process<2>(var_nodes, branches, tid); break;
+			case 3:  this->BP_process<3>(var_nodes, branches, tid); break;
+			case 4:  this->BP_process<4>(var_nodes, branches, tid); break;
+			case 5:  this->BP_process<5>(var_nodes, branches, tid); break;
+			case 6:  this->BP_process<6>(var_nodes, branches, tid); break;
+			case 7:  this->BP_process<7>(var_nodes, branches, tid); break;
+			case 8:  this->BP_process<8>(var_nodes, branches, tid); break;
+			default: this->BP_process<0>(var_nodes, branches, tid); break;
+		}
+
+		// stop criterion (checked by the thread 0, the other threads wait for the result)
+		if (this->enable_syndrome)
+		{
+			if (tid == 0)
+				this->team_syndrome = this->check_syndrome(frame_id);
+			if (this->n_threads > 1)
+				this->team_barrier(tid);
+		}
+
+		if (this->enable_syndrome && this->team_syndrome)
+		{
+			cur_syndrome_depth++;
+			if (cur_syndrome_depth == this->syndrome_depth)
+				break;
+		}
+		else
+			cur_syndrome_depth = 0;
+	}
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::check_syndrome(const int frame_id)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+
+	// the lanes of the last vector of a layer which are after the Z check nodes
+	R lanes[n_lanes];
+	for (auto l = 0; l < n_lanes; l++)
+		lanes[l] = (R)(l < this->Z - (this->Z_pad - n_lanes) ? 1 : 0);
+	const auto last_lanes = mipp::Reg<R>(lanes) != zero;
+
+	const auto var_nodes = this->var_nodes[frame_id].data();
+
+	for (auto l = 0; l < (int)this->layer_offsets.size() -1; l++)
+	{
+		auto syndrome = zero_msk;
+		for (auto i = 0; i < this->Z_pad; i += n_lanes)
+		{
+			auto sign = zero_msk;
+			for (auto b = this->layer_offsets[l]; b < this->layer_offsets[l +1]; b++)
+			{
+				mipp::Reg<R> var;
+				var.loadu(var_nodes + this->block_cols[b] * this->Z_ext + (this->block_shifts[b] + i) % this->Z);
+
+				sign ^= mipp::sign(var);
+			}
+
+			syndrome |= (i + n_lanes <= this->Z) ? sign : sign & last_lanes;
+		}
+
+		// stop at the first layer which is not verified
+		for (auto j = 0; j < n_lanes; j++)
+			if (syndrome[j])
+				return false;
+	}
+
+	return true;
+}
+
+// BP algorithm
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_layered_ONMS_intra<B,R>
+::BP_process(mipp::vector<R> &var_nodes, mipp::vector<R> &branches, const int tid)
+{
+	constexpr auto n_lanes = mipp::nElReg<R>();
+
+	// the SIMD vectors of check nodes of the thread (the same ones in all the layers)
+	const auto n_vectors = this->Z_pad / n_lanes;
+	const auto first_vec = ((tid +0) * n_vectors / this->n_threads) * n_lanes;
+	const auto last_vec  = ((tid +1) * n_vectors / this->n_threads) * n_lanes;
+
+	const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+	const auto zero     = mipp::Reg<R>((R)0);
+
+	for (auto l = 0; l < (int)this->layer_offsets.size() -1; l++)
+	{
+		const auto first    = (int)this->layer_offsets[l];
+		const auto n_blocks = (int)this->layer_offsets[l +1] - first;
+
+		// the Z check nodes of the layer, 'n_lanes' at a time (the last lanes of the last vector are not used)
+		for (auto i = first_vec; i < last_vec; i += n_lanes)
+		{
+			auto sign = zero_msk;
+			auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
+			auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
+
+			for (auto j = 0; j < n_blocks; j++)
+			{
+				const auto b = first + j;
+
+				// rotated load: the variable nodes of the check nodes [i, i + n_lanes[ in the block column
+				mipp::Reg<R> var, branch;
+				var   .loadu(var_nodes.data() + this->block_cols[b] * this->Z_ext + (this->block_shifts[b] + i) % this->Z);
+				branch.load (branches .data() + b * this->Z_pad + i);
+
+				const auto contribution = var - branch;
+				contribution.store(this->contributions.data() + j * this->Z_pad + i);
+
+				const auto v_abs  = mipp::abs(contribution);
+				const auto v_temp = min1;
+
+				sign ^= mipp::sign(contribution);
+				min1  = mipp::min(min1,           v_abs         ); // 1st min
+				min2  = mipp::min(min2, mipp::max(v_abs, v_temp)); // 2nd min
+			}
+
+			// the offset values are set to zero before the normalization (the fixed-point normalization works on the positive
+			// values)
+			const auto cste1 = simd_sat<R>(simd_normalize<R,F>(mipp::max(min2 - offset, zero), normalize_factor), saturation);
+			const auto cste2 = simd_sat<R>(simd_normalize<R,F>(mipp::max(min1 - offset, zero), normalize_factor), saturation);
+
+			for (auto j = 0; j < n_blocks; j++)
+			{
+				const auto b = first + j;
+
+				mipp::Reg<R> value;
+				value.load(this->contributions.data() + j * this->Z_pad + i);
+
+				const auto v_abs = mipp::abs(value);
+				      auto v_res = mipp::blend(cste1, cste2, v_abs == min1);
+				const auto v_sig = sign ^ mipp::sign(value);
+				           v_res = mipp::copysign(v_res, v_sig);
+
+				v_res          .store(branches.data()            + b * this->Z_pad + i);
+				(value + v_res).store(this->contributions.data() + j * this->Z_pad + i);
+			}
+		}
+
+		// all the check nodes of the layer have to be updated before the block columns are written
+		if (this->n_threads > 1)
+			this->team_barrier(tid);
+
+		// write the updated variable nodes back in the natural order of their block columns
+		const auto first_block = (tid +0) * n_blocks / this->n_threads;
+		const auto last_block  = (tid +1) * n_blocks / this->n_threads;
+		for (auto j = first_block; j < last_block; j++)
+		{
+			const auto b         = first + j;
+			const auto shift     = (int)this->block_shifts[b];
+			const auto updated   = this->contributions.data() + j * this->Z_pad;
+			const auto block_col = var_nodes.data() + this->block_cols[b] * this->Z_ext;
+
+			std::copy(updated,                   updated + this->Z - shift, block_col + shift);
+			std::copy(updated + this->Z - shift, updated + this->Z,         block_col        );
+			this->update_copy(block_col);
+		}
+
+		// the next layer reads the block columns written by the other threads
+		if (this->n_threads > 1)
+			this->team_barrier(tid);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_layered_ONMS_intra<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,122 @@
+#ifndef DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_
+#define DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+#include "../../../../Decoder_SISO.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Threads/Spin_barrier.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Layered offset normalized min-sum for the quasi-cyclic codes, with the intra-frame SIMD strategy: a layer is a block
+ * row of H (Z check nodes which do not share any variable node) and its Z check nodes are processed in the SIMD lanes.
+ * The Z values of a block column are read in the order of a check node block with rotated (unaligned) loads: each
+ * block column is followed by a copy of its first values so the loads never have to wrap around.
+ *
+ * A frame can be decoded by a team of 'n_threads' threads (the calling thread and 'n_threads' - 1 threads created by
+ * the decoder): the check nodes of a layer are shared between the threads, then the updated block columns, with a
+ * barrier after each step. The threads of the team wait for the next frame on a condition variable.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_layered_ONMS_intra : public Decoder_SISO<B,R>
+{
+private:
+	const float normalize_factor;
+	const R     offset;
+	const R     saturation;
+	int         normalize_id; // 'normalize_factor' * 8 when the normalization is made with shifts, 0 otherwise
+
+protected:
+	const int n_ite;     // number of iterations to perform
+	const int n_C_nodes; // number of check nodes (= N - K)
+
+	const bool enable_syndrome;
+	const int  syndrome_depth;
+
+	// reset so the branches and var_nodes structures can be cleared only at the beginning of the loop in iterative
+	// decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// quasi-cyclic structure of H (detected in the constructor)
+	int Z;            // lifting size
+	int n_block_cols; // number of variable nodes blocks (= N / Z)
+	int Z_pad;        // Z rounded up to a multiple of the SIMD width (storage of the messages of a block)
+	int Z_ext;        // Z + SIMD width - 1 (storage of a block column followed by a copy of its first values)
+
+	// the blocks of the layer 'l' are the blocks [layer_offsets[l], layer_offsets[l +1][
+	std::vector<unsigned> layer_offsets;
+	std::vector<unsigned> block_cols;    // block column of each block
+	std::vector<unsigned> block_shifts;  // shift of each block
+
+	// data structures for iterative decoding
+	std::vector<mipp::vector<R>> var_nodes;     // 'n_block_cols' x 'Z_ext' per frame
+	std::vector<mipp::vector<R>> branches;      // number of blocks x 'Z_pad' per frame
+	            mipp::vector<R>  contributions; // messages of the blocks of the current layer
+
+	// team of threads decoding the same frame (the thread 0 is the calling thread)
+	const int                n_threads;
+	std::vector<std::thread> team;
+	tools::Spin_barrier      team_barrier;  // synchronization of the threads between the steps of a layer
+	std::mutex               team_mutex;
+	std::condition_variable  team_cond;
+	int                      team_job;      // incremented to start the decoding of 'team_frame_id' by the team
+	int                      team_frame_id;
+	bool                     team_stop;     // the threads of the team exit
+	bool                     team_syndrome; // result of the syndrome check of the current iteration (by the thread 0)
+
+public:
+	Decoder_LDPC_BP_layered_ONMS_intra(const int &K, const int &N, const int& n_ite,
+	                                   const tools::Sparse_matrix &H,
+	                                   const std::vector<unsigned> &info_bits_pos,
+	                                   const float normalize_factor = 1.f,
+	                                   const R offset = (R)0,
+	                                   const bool enable_syndrome = true,
+	                                   const int syndrome_depth = 1,
+	                                   const int n_frames = 1,
+	                                   const int n_threads = 1,
+	                                   const std::string name = "Decoder_LDPC_BP_layered_ONMS_intra");
+	virtual ~Decoder_LDPC_BP_layered_ONMS_intra();
+
+protected:
+	// soft decode
+	void _soft_decode(const R *Y_N1, R *Y_N2, const int frame_id);
+
+	// hard decoder (load -> decode -> store)
+	void _load       (const R *Y_N,         const int frame_id);
+	void _hard_decode(const R *Y_N, B *V_K, const int frame_id);
+	void _store      (              B *V_K, const int frame_id) const;
+
+	// BP functions for decoding
+	void BP_decode(const int frame_id);
+
+	// the iterations of the thread 'tid' of the team
+	void BP_decode_team(const int frame_id, const int tid);
+
+	bool check_syndrome(const int frame_id);
+
+	template <int F = 0>
+	void BP_process(mipp::vector<R> &var_nodes, mipp::vector<R> &branches, const int tid = 0);
+
+private:
+	// main loop of the threads 1 to 'n_threads' - 1 of the team
+	void team_loop(const int tid);
+
+	// position of the variable node 'v' (natural order) in 'var_nodes'
+	inline int VN_pos(const int v) const;
+
+	// copy the first values of a block column after its end (for the rotated loads)
+	inline void update_copy(R *block_col) const;
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_LAYERED_ONMS_INTRA_HPP_ */
@@ -24,6 +24,7 @@ public:
 	                                                 const bool enable_syndrome = true,
 	                                                 const int syndrome_depth = 1,
 	                                                 const int n_frames = 1,
+	                                                 const bool reorder = false,
 	                                                 const std::string name = "Decoder_LDPC_BP_layered_offset_normalize_min_sum");
 	virtual ~Decoder_LDPC_BP_layered_offset_normalize_min_sum();
 
@@ -21,6 +21,7 @@ public:
 	                                    const bool enable_syndrome = true,
 	                                    const int syndrome_depth = 1,
 	                                    const int n_frames = 1,
+	                                    const bool reorder = false,
 	                                    const std::string name = "Decoder_LDPC_BP_layered_sum_product");
 	virtual ~Decoder_LDPC_BP_layered_sum_product();
 
@@ -0,0 +1,197 @@
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_residual.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_residual<B,R>
+::Decoder_LDPC_BP_residual(const int &K, const int &N, const int& n_ite,
+                           const Sparse_matrix &H,
+                           const std::vector<unsigned> &info_bits_pos,
+                           const bool enable_syndrome,
+                           const int syndrome_depth,
+                           const int n_frames,
+                           const std::string name)
+: Decoder_SISO<B,R>(K, N, n_frames, 1, name                    ),
+  n_ite            (n_ite                                      ),
+  n_V_nodes        (N                                          ), // same as N but more explicit
+  n_C_nodes        ((int)H.get_n_cols()                        ),
+  n_branches       ((int)H.get_n_connections()                 ),
+  enable_syndrome  (enable_syndrome                            ),
+  syndrome_depth   (syndrome_depth                             ),
+  init_flag        (true                                       ),
+  info_bits_pos    (info_bits_pos                              ),
+  CN_offsets       (H.get_n_cols() +1, 0                       ),
+  CN_to_VN         (this->n_branches                           ),
+  VN_offsets       (N +1, 0                                    ),
+  VN_to_CN         (this->n_branches                           ),
+  VN_to_branch     (this->n_branches                           ),
+  syndrome         (H                                          ),
+  queue            ((int)H.get_n_cols(), 4 * 64 + 4           ),
+  CN_stamp         (H.get_n_cols(), -1                         ),
+  n_updates        (0                                          ),
+  Lp_N             (N,                                       -1), // -1 in order to fail when AZCW
+  C_to_V           (n_frames, mipp::vector<R>(this->n_branches)),
+  V_to_C           (this->n_branches                           ),
+  C_to_V_next      (this->n_branches                           )
+{
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << H.get_n_rows() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto c = 0; c < this->n_C_nodes; c++)
+	{
+		const auto &VNs = H[c];
+		this->CN_offsets[c +1] = this->CN_offsets[c] + (unsigned)VNs.size();
+		std::copy(VNs.begin(), VNs.end(), this->CN_to_VN.begin() + this->CN_offsets[c]);
+	}
+
+	const auto &VN_to_CN_list = H.get_row_to_cols();
+	for (auto v = 0; v < N; v++)
+		this->VN_offsets[v +1] = this->VN_offsets[v] + (unsigned)VN_to_CN_list[v].size();
+
+	// the branches of each variable node, in the order of the check nodes
+	std::vector<unsigned> connections(N, 0);
+	for (auto c = 0; c < this->n_C_nodes; c++)
+		for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+		{
+			const auto v = this->CN_to_VN[b];
+			const auto k = this->VN_offsets[v] + connections[v]++;
+
+			this->VN_to_CN    [k] = c;
+			this->VN_to_branch[k] = b;
+		}
+
+	this->modified.reserve(this->n_C_nodes);
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_residual<B,R>
+::~Decoder_LDPC_BP_residual()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual<B,R>
+::_soft_decode(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->C_to_V[frame_id].begin(), this->C_to_V[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+
+	// actual decoding
+	this->BP_decode(Y_N1, frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		Y_N2[i] = this->Lp_N[i] - Y_N1[i];
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual<B,R>
+::_hard_decode(const R *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->C_to_V[frame_id].begin(), this->C_to_V[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	// actual decoding
+	this->BP_decode(Y_N, frame_id);
+	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_K[i] = !(this->Lp_N[k] >= 0);
+	}
+
+	// set the flag so C_to_V structure can be reset to 0 only at the beginning of the loop in iterative decoding
+	if (frame_id == Decoder<B,R>::n_frames -1)
+		this->init_flag = true;
+
+	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+	this->d_load_total  += d_load;
+	this->d_decod_total += d_decod;
+	this->d_store_total += d_store;
+}
+
+// BP algorithm
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual<B,R>
+::BP_decode(const R *Y_N, const int frame_id)
+{
+	auto &C_to_V = this->C_to_V[frame_id];
+
+	this->BP_init(Y_N, C_to_V);
+
+	auto cur_syndrome_depth = 0;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		// the check nodes with the largest residuals are updated first
+		if (!this->BP_process(C_to_V))
+			break;
+
+		// stop criterion
+		if (this->enable_syndrome && this->syndrome.check(this->Lp_N.data()))
+		{
+			cur_syndrome_depth++;
+			if (cur_syndrome_depth == this->syndrome_depth)
+				break;
+		}
+		else
+			cur_syndrome_depth = 0;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_residual<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_residual<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_residual<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_residual<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_residual<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,109 @@
+#ifndef DECODER_LDPC_BP_RESIDUAL_HPP_
+#define DECODER_LDPC_BP_RESIDUAL_HPP_
+
+#include "../../../Decoder_SISO.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Bucket_queue/Bucket_queue.hpp"
+#include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Residual BP with node-wise scheduling: the messages the check nodes would send if they were updated now are kept
+ * up to date, and the residual of a check node is the largest change between these messages and the ones it sent
+ * last. The check node with the largest residual is updated first (it sends all its messages), then the residuals of
+ * the check nodes which share a variable node with it are computed again. The messages which barely change are not
+ * recomputed, so the decoder converges in less updates than the flooding and the layered schedules.
+ *
+ * The check nodes are sorted in a bucket queue (logarithmic quantization of the residuals): the check nodes of the
+ * same bucket are updated in any order. 'n_C_nodes' updates count as one iteration (for the stop criterion and for
+ * 'n_ite') and the decoding stops when all the residuals are zero.
+ *
+ * The derived classes give the check node update rule with 'CN_compute' (called by 'BP_init_residuals' and
+ * 'BP_process_residuals' without virtual calls), which computes the messages of a check node in 'C_to_V_next'.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_residual : public Decoder_SISO<B,R>
+{
+protected:
+	const int  n_ite;      // number of iterations to perform (of 'n_C_nodes' check node updates)
+	const int  n_V_nodes;  // number of variable nodes (= N)
+	const int  n_C_nodes;  // number of check    nodes (= N - K)
+	const int  n_branches; // number of branches in the bi-partite graph (connexions between the V and C nodes)
+
+	const bool enable_syndrome;
+	const int  syndrome_depth;
+
+	// reset so C_to_V structure can be cleared only at the beginning of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// the messages are stored check node by check node: the branches of the check node 'c' are
+	// [CN_offsets[c], CN_offsets[c +1][ (going to the variable nodes 'CN_to_VN'), and the branches of the variable
+	// node 'v' are VN_to_branch[VN_offsets[v]], ..., VN_to_branch[VN_offsets[v +1] -1] (going to the check nodes
+	// 'VN_to_CN')
+	std::vector<unsigned> CN_offsets;
+	std::vector<unsigned> CN_to_VN;
+	std::vector<unsigned> VN_offsets;
+	std::vector<unsigned> VN_to_CN;
+	std::vector<unsigned> VN_to_branch;
+
+	tools::LDPC_syndrome syndrome; // parity checks of the hard decisions of 'Lp_N'
+	tools::Bucket_queue  queue;    // check nodes sorted by residual (the check nodes with a zero residual are out)
+
+	std::vector<int>      CN_stamp; // last update in which the check node was marked as modified
+	std::vector<unsigned> modified; // check nodes to compute again after an update
+	int                   n_updates;
+
+	// data structures for iterative decoding
+	            mipp::vector<R>  Lp_N;        // a posteriori information
+	std::vector<mipp::vector<R>> C_to_V;      // check    nodes to variable nodes messages (kept for the turbo decoding)
+	            mipp::vector<R>  V_to_C;      // variable nodes to check    nodes messages
+	            mipp::vector<R>  C_to_V_next; // check    nodes to variable nodes messages if the check nodes are updated
+
+	Decoder_LDPC_BP_residual(const int &K, const int &N, const int& n_ite,
+	                         const tools::Sparse_matrix &H,
+	                         const std::vector<unsigned> &info_bits_pos,
+	                         const bool enable_syndrome = true,
+	                         const int syndrome_depth = 1,
+	                         const int n_frames = 1,
+	                         const std::string name = "Decoder_LDPC_BP_residual");
+	virtual ~Decoder_LDPC_BP_residual();
+
+	// soft decode
+	void _soft_decode(const R *Y_N1, R *Y_N2, const int frame_id);
+
+	// hard decoder
+	void _hard_decode(const R *Y_N, B *V_K, const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const R *Y_N, const int frame_id);
+
+	// computes the a posteriori information, the V_to_C messages and the residuals of all the check nodes
+	virtual void BP_init(const R *Y_N, const mipp::vector<R> &C_to_V) = 0;
+
+	// one iteration ('n_C_nodes' check node updates), returns false when all the residuals are zero
+	virtual bool BP_process(mipp::vector<R> &C_to_V) = 0;
+
+	// same as 'BP_init' and 'BP_process' with the check node update rule of 'D' (a derived class)
+	template <class D>
+	void BP_init_residuals(D &rule, const R *Y_N, const mipp::vector<R> &C_to_V);
+	template <class D>
+	bool BP_process_residuals(D &rule, mipp::vector<R> &C_to_V);
+
+private:
+	template <class D>
+	inline void CN_residual(D &rule, const int c, const mipp::vector<R> &C_to_V);
+
+	// 4 buckets per octave from 2^-31 to 2^33, the bucket 0 is never used (zero residual)
+	static inline int bucket(const float residual);
+};
+}
+}
+
+#include "Decoder_LDPC_BP_residual.hxx"
+
+#endif /* DECODER_LDPC_BP_RESIDUAL_HPP_ */
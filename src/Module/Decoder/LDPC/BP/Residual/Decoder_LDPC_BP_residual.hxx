@@ -0,0 +1,124 @@
+#include <cmath>
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_residual.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+int Decoder_LDPC_BP_residual<B,R>
+::bucket(const float residual)
+{
+	// std::frexp gives an unspecified exponent for the infinite and NaN residuals (saturated messages): they go in the
+	// top bucket
+	if (!std::isfinite(residual))
+		return (33 + 31) * 4 + 3;
+
+	auto exp = 0;
+	const auto mant = std::frexp(residual, &exp); // residual = mant * 2^exp with mant in [0.5, 1[
+	const auto sub  = std::min(3, (int)((mant - 0.5f) * 8.f));
+
+	exp = std::max(-30, std::min(33, exp));
+
+	return (exp + 31) * 4 + sub;
+}
+
+template <typename B, typename R>
+template <class D>
+void Decoder_LDPC_BP_residual<B,R>
+::CN_residual(D &rule, const int c, const mipp::vector<R> &C_to_V)
+{
+	rule.CN_compute(c);
+
+	auto residual = 0.f;
+	for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+		residual = std::max(residual, std::abs((float)this->C_to_V_next[b] - (float)C_to_V[b]));
+
+	if (residual > 0.f)
+		this->queue.update(c, bucket(residual));
+	else
+		this->queue.remove(c);
+}
+
+template <typename B, typename R>
+template <class D>
+void Decoder_LDPC_BP_residual<B,R>
+::BP_init_residuals(D &rule, const R *Y_N, const mipp::vector<R> &C_to_V)
+{
+	// the variable nodes messages from the channel and the C_to_V messages of the previous turbo iteration
+	for (auto v = 0; v < this->n_V_nodes; v++)
+	{
+		auto sum_C_to_V = (R)0;
+		for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+			sum_C_to_V += C_to_V[this->VN_to_branch[k]];
+
+		const auto app = Y_N[v] + sum_C_to_V;
+		this->Lp_N[v] = app;
+
+		for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+		{
+			const auto b = this->VN_to_branch[k];
+			this->V_to_C[b] = app - C_to_V[b];
+		}
+	}
+
+	this->queue.clear();
+	std::fill(this->CN_stamp.begin(), this->CN_stamp.end(), -1);
+	this->n_updates = 0;
+
+	for (auto c = 0; c < this->n_C_nodes; c++)
+		this->CN_residual(rule, c, C_to_V);
+}
+
+template <typename B, typename R>
+template <class D>
+bool Decoder_LDPC_BP_residual<B,R>
+::BP_process_residuals(D &rule, mipp::vector<R> &C_to_V)
+{
+	for (auto u = 0; u < this->n_C_nodes; u++)
+	{
+		const auto c = this->queue.pop();
+		if (c < 0)
+			return false; // all the residuals are zero: the messages do not change anymore
+
+		const auto stamp = this->n_updates++;
+		this->CN_stamp[c] = stamp; // the incoming messages of 'c' do not change (only its outgoing messages)
+		this->modified.clear();
+
+		// the check node sends its messages
+		for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+		{
+			const auto v = this->CN_to_VN[b];
+			this->Lp_N[v] += this->C_to_V_next[b] - C_to_V[b];
+			C_to_V[b] = this->C_to_V_next[b];
+		}
+
+		// the variable nodes update their messages to the other check nodes
+		for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+		{
+			const auto v = this->CN_to_VN[b];
+			for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+			{
+				const auto b2 = this->VN_to_branch[k];
+				const auto c2 = this->VN_to_CN[k];
+
+				this->V_to_C[b2] = this->Lp_N[v] - C_to_V[b2];
+				if (this->CN_stamp[c2] != stamp)
+				{
+					this->CN_stamp[c2] = stamp;
+					this->modified.push_back(c2);
+				}
+			}
+		}
+
+		// the residuals of the modified check nodes
+		for (auto c2 : this->modified)
+			this->CN_residual(rule, c2, C_to_V);
+	}
+
+	return true;
+}
+}
+}
@@ -0,0 +1,138 @@
+#include <limits>
+#include <sstream>
+#include <typeinfo>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+
+#include "Decoder_LDPC_BP_residual_offset_normalize_min_sum.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename R>
+inline R normalize(const R val, const float factor)
+{
+	     if (factor == 0.125f) return div8<R>(val);
+	else if (factor == 0.250f) return div4<R>(val);
+	else if (factor == 0.375f) return div4<R>(val) + div8<R>(val);
+	else if (factor == 0.500f) return div2<R>(val);
+	else if (factor == 0.625f) return div2<R>(val) + div8<R>(val);
+	else if (factor == 0.750f) return div2<R>(val) + div4<R>(val);
+	else if (factor == 0.875f) return div2<R>(val) + div4<R>(val) + div8<R>(val);
+	else if (factor == 1.000f) return val;
+	else
+	{
+		std::stringstream message;
+		message << "'factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f ('factor' = "
+		        << factor << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <>
+inline float normalize(const float val, const float factor)
+{
+	return val * factor;
+}
+
+template <>
+inline double normalize(const double val, const float factor)
+{
+	return val * (double)factor;
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,R>
+::Decoder_LDPC_BP_residual_offset_normalize_min_sum(const int &K, const int &N, const int& n_ite,
+                                                    const Sparse_matrix &H,
+                                                    const std::vector<unsigned> &info_bits_pos,
+                                                    const float normalize_factor,
+                                                    const R offset,
+                                                    const bool enable_syndrome,
+                                                    const int syndrome_depth,
+                                                    const int n_frames,
+                                                    const std::string name)
+: Decoder_LDPC_BP_residual<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, name),
+  normalize_factor(normalize_factor), offset(offset)
+{
+	if (typeid(R) == typeid(signed char))
+	{
+		std::stringstream message;
+		message << "This decoder does not work in 8-bit fixed-point (try in 16-bit).";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,R>
+::~Decoder_LDPC_BP_residual_offset_normalize_min_sum()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,R>
+::BP_init(const R *Y_N, const mipp::vector<R> &C_to_V)
+{
+	this->BP_init_residuals(*this, Y_N, C_to_V);
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,R>
+::BP_process(mipp::vector<R> &C_to_V)
+{
+	return this->BP_process_residuals(*this, C_to_V);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,R>
+::CN_compute(const int c)
+{
+	auto sign = 0;
+	auto min1 = std::numeric_limits<R>::max();
+	auto min2 = std::numeric_limits<R>::max();
+	auto min1_branch = this->CN_offsets[c];
+
+	for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+	{
+		const auto value = this->V_to_C[b];
+		const auto v_abs = (R)std::abs(value);
+
+		sign ^= std::signbit((float)value) ? -1 : 0;
+		if (v_abs < min1)
+		{
+			min2        = min1;
+			min1        = v_abs;
+			min1_branch = b;
+		}
+		else
+			min2 = std::min(min2, v_abs);
+	}
+
+	auto cste1 = normalize<R>(min2 - offset, normalize_factor);
+	auto cste2 = normalize<R>(min1 - offset, normalize_factor);
+	cste1 = (cste1 < 0) ? 0 : cste1;
+	cste2 = (cste2 < 0) ? 0 : cste2;
+
+	for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+	{
+		const auto value = this->V_to_C[b];
+		const auto v_res = (b == min1_branch) ? cste1 : cste2;
+		const auto v_sig = sign ^ (std::signbit((float)value) ? -1 : 0); // xor bit
+
+		this->C_to_V_next[b] = (R)std::copysign(v_res, v_sig); // magnitude of v_res, sign of v_sig
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_residual_offset_normalize_min_sum<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_residual_offset_normalize_min_sum<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_residual_offset_normalize_min_sum<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_residual_offset_normalize_min_sum<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
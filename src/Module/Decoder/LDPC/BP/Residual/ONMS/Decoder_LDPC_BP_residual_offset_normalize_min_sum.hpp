@@ -0,0 +1,45 @@
+#ifndef DECODER_LDPC_BP_RESIDUAL_MIN_SUM_OFFSET_HPP_
+#define DECODER_LDPC_BP_RESIDUAL_MIN_SUM_OFFSET_HPP_
+
+#include "../Decoder_LDPC_BP_residual.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_residual_offset_normalize_min_sum : public Decoder_LDPC_BP_residual<B,R>
+{
+	friend class Decoder_LDPC_BP_residual<B,R>;
+
+private:
+	const float normalize_factor;
+	const R offset;
+
+public:
+	Decoder_LDPC_BP_residual_offset_normalize_min_sum(const int &K, const int &N, const int& n_ite,
+	                                                  const tools::Sparse_matrix &H,
+	                                                  const std::vector<unsigned> &info_bits_pos,
+	                                                  const float normalize_factor = 1.f,
+	                                                  const R offset = (R)0,
+	                                                  const bool enable_syndrome = true,
+	                                                  const int syndrome_depth = 1,
+	                                                  const int n_frames = 1,
+	                                                  const std::string name = "Decoder_LDPC_BP_residual_offset_normalize_min_sum");
+	virtual ~Decoder_LDPC_BP_residual_offset_normalize_min_sum();
+
+protected:
+	// BP functions for decoding
+	void BP_init   (const R *Y_N, const mipp::vector<R> &C_to_V);
+	bool BP_process(              mipp::vector<R> &C_to_V);
+
+	// check node update rule
+	inline void CN_compute(const int c);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_residual_ONMS = Decoder_LDPC_BP_residual_offset_normalize_min_sum<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_RESIDUAL_MIN_SUM_OFFSET_HPP_ */
@@ -0,0 +1,93 @@
+#include <typeinfo>
+#include <limits>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_residual_sum_product.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_residual_sum_product<B,R>
+::Decoder_LDPC_BP_residual_sum_product(const int &K, const int &N, const int& n_ite,
+                                       const Sparse_matrix &H,
+                                       const std::vector<unsigned> &info_bits_pos,
+                                       const bool enable_syndrome,
+                                       const int syndrome_depth,
+                                       const int n_frames,
+                                       const std::string name)
+: Decoder_LDPC_BP_residual<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, name),
+  values(H.get_n_connections())
+{
+	if (typeid(R) != typeid(float) && typeid(R) != typeid(double))
+		throw runtime_error(__FILE__, __LINE__, __func__, "This decoder only supports floating-point LLRs.");
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_residual_sum_product<B,R>
+::~Decoder_LDPC_BP_residual_sum_product()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual_sum_product<B,R>
+::BP_init(const R *Y_N, const mipp::vector<R> &C_to_V)
+{
+	this->BP_init_residuals(*this, Y_N, C_to_V);
+}
+
+template <typename B, typename R>
+bool Decoder_LDPC_BP_residual_sum_product<B,R>
+::BP_process(mipp::vector<R> &C_to_V)
+{
+	return this->BP_process_residuals(*this, C_to_V);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_residual_sum_product<B,R>
+::CN_compute(const int c)
+{
+	auto sign    =    0;
+	auto prod    = (R)1;
+	auto n_zeros =    0;
+
+	for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+	{
+		const auto value = this->V_to_C[b];
+		const auto res   = (R)std::tanh((R)std::abs(value) * (R)0.5);
+
+		sign ^= std::signbit((float)value) ? -1 : 0;
+		if (res != 0) prod *= res; else n_zeros++;
+		this->values[b] = res;
+	}
+
+	for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+	{
+		const auto value = this->V_to_C[b];
+		const auto res   = this->values[b];
+
+		// product of the other incoming values
+		auto val = (res == 0) ? (n_zeros > 1 ? (R)0 : prod      ) :
+		                        (n_zeros > 0 ? (R)0 : prod / res);
+		     val = (val < (R)1.0) ? val : (R)1.0 - std::numeric_limits<R>::epsilon();
+
+		const auto v_sig = sign ^ (std::signbit((float)value) ? -1 : 0);
+		const auto v_tan = (R)2.0 * std::atanh(val);
+
+		this->C_to_V_next[b] = (R)std::copysign(v_tan, v_sig);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_residual_sum_product<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_residual_sum_product<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_residual_sum_product<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_residual_sum_product<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_residual_sum_product<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,42 @@
+#ifndef DECODER_LDPC_BP_RESIDUAL_SUM_PRODUCT_HPP_
+#define DECODER_LDPC_BP_RESIDUAL_SUM_PRODUCT_HPP_
+
+#include "../Decoder_LDPC_BP_residual.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_residual_sum_product : public Decoder_LDPC_BP_residual<B,R>
+{
+	friend class Decoder_LDPC_BP_residual<B,R>;
+
+private:
+	mipp::vector<R> values; // tanh of the half magnitudes of the V_to_C messages
+
+public:
+	Decoder_LDPC_BP_residual_sum_product(const int &K, const int &N, const int& n_ite,
+	                                     const tools::Sparse_matrix &H,
+	                                     const std::vector<unsigned> &info_bits_pos,
+	                                     const bool enable_syndrome = true,
+	                                     const int syndrome_depth = 1,
+	                                     const int n_frames = 1,
+	                                     const std::string name = "Decoder_LDPC_BP_residual_sum_product");
+	virtual ~Decoder_LDPC_BP_residual_sum_product();
+
+protected:
+	// BP functions for decoding
+	void BP_init   (const R *Y_N, const mipp::vector<R> &C_to_V);
+	bool BP_process(              mipp::vector<R> &C_to_V);
+
+	// check node update rule
+	inline void CN_compute(const int c);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_residual_SPA = Decoder_LDPC_BP_residual_sum_product<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_RESIDUAL_SUM_PRODUCT_HPP_ */
@@ -0,0 +1,311 @@
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_shuffled.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_shuffled<B,R>
+::Decoder_LDPC_BP_shuffled(const int &K, const int &N, const int& n_ite,
+                           const Sparse_matrix &H,
+                           const std::vector<unsigned> &info_bits_pos,
+                           const bool enable_syndrome,
+                           const int syndrome_depth,
+                           const int n_frames,
+                           const int group_size,
+                           const int n_threads,
+                           const std::string name)
+: Decoder_SISO<B,R>(K, N, n_frames, 1, name                    ),
+  n_ite            (n_ite                                      ),
+  n_V_nodes        (N                                          ), // same as N but more explicit
+  n_C_nodes        ((int)H.get_n_cols()                        ),
+  n_branches       ((int)H.get_n_connections()                 ),
+  group_size       (group_size                                 ),
+  enable_syndrome  (enable_syndrome                            ),
+  syndrome_depth   (syndrome_depth                             ),
+  init_flag        (true                                       ),
+  info_bits_pos    (info_bits_pos                              ),
+  CN_offsets       (H.get_n_cols() +1, 0                       ),
+  VN_offsets       (N +1, 0                                    ),
+  VN_to_CN         (this->n_branches                           ),
+  VN_to_branch     (this->n_branches                           ),
+  syndrome         (H                                          ),
+  Lp_N             (N,                                       -1), // -1 in order to fail when AZCW
+  C_to_V           (n_frames, mipp::vector<R>(this->n_branches)),
+  V_to_C           (this->n_branches                           ),
+  V_to_C_old       (this->n_branches                           ),
+  n_threads        (n_threads                                  ),
+  team_barrier     (std::max(n_threads, 1)                     ),
+  team_job         (0                                          ),
+  team_frame_id    (0                                          ),
+  team_Y_N         (nullptr                                    ),
+  team_stop        (false                                      ),
+  team_syndrome    (false                                      )
+{
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (group_size <= 0)
+	{
+		std::stringstream message;
+		message << "'group_size' has to be greater than 0 ('group_size' = " << group_size << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << H.get_n_rows() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto c = 0; c < this->n_C_nodes; c++)
+		this->CN_offsets[c +1] = this->CN_offsets[c] + (unsigned)H[c].size();
+
+	const auto &VN_to_CN_list = H.get_row_to_cols();
+	for (auto v = 0; v < N; v++)
+		this->VN_offsets[v +1] = this->VN_offsets[v] + (unsigned)VN_to_CN_list[v].size();
+
+	// the branches of each variable node, in the order of the check nodes
+	std::vector<unsigned> connections(N, 0);
+	for (auto c = 0; c < this->n_C_nodes; c++)
+		for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+		{
+			const auto v = H[c][b - this->CN_offsets[c]];
+			const auto k = this->VN_offsets[v] + connections[v]++;
+
+			this->VN_to_CN    [k] = c;
+			this->VN_to_branch[k] = b;
+		}
+
+	// the check nodes connected to each group (in the order of their first message)
+	std::vector<int>      CN_group(this->n_C_nodes, -1);
+	std::vector<unsigned> CN_pos  (this->n_C_nodes,  0);
+	this->group_offsets.push_back(0);
+	for (auto first = 0, g = 0; first < N; first += group_size, g++)
+	{
+		const auto last = std::min(first + group_size, N);
+		for (auto k = this->VN_offsets[first]; k < this->VN_offsets[last]; k++)
+		{
+			const auto c = this->VN_to_CN[k];
+			if (CN_group[c] != g)
+			{
+				CN_group[c] = g;
+				CN_pos  [c] = (unsigned)this->group_CN.size();
+				this->group_CN.push_back(c);
+				this->group_k .push_back(k);
+			}
+			else
+				this->group_k[CN_pos[c]] = (unsigned)this->n_branches;
+		}
+		this->group_offsets.push_back((unsigned)this->group_CN.size());
+	}
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_shuffled<B,R>
+::~Decoder_LDPC_BP_shuffled()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->team_mutex);
+		this->team_stop = true;
+	}
+	this->team_cond.notify_all();
+
+	for (auto &thread : this->team)
+		thread.join();
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled<B,R>
+::team_loop(const int tid)
+{
+	auto job      = 0;
+	auto frame_id = 0;
+	auto Y_N      = (const R*)nullptr;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(this->team_mutex);
+			this->team_cond.wait(lock, [&]() { return this->team_job != job || this->team_stop; });
+
+			if (this->team_stop)
+				return;
+			job      = this->team_job;
+			frame_id = this->team_frame_id;
+			Y_N      = this->team_Y_N;
+		}
+
+		this->BP_decode_team(Y_N, frame_id, tid);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled<B,R>
+::_soft_decode(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->C_to_V[frame_id].begin(), this->C_to_V[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+
+	// actual decoding
+	this->BP_decode(Y_N1, frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto i = 0; i < this->N; i++)
+		Y_N2[i] = this->Lp_N[i] - Y_N1[i];
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled<B,R>
+::_hard_decode(const R *Y_N, B *V_K, const int frame_id)
+{
+	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	// memory zones initialization
+	if (this->init_flag)
+	{
+		std::fill(this->C_to_V[frame_id].begin(), this->C_to_V[frame_id].end(), (R)0);
+
+		if (frame_id == Decoder<B,R>::n_frames -1)
+			this->init_flag = false;
+	}
+	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	// actual decoding
+	this->BP_decode(Y_N, frame_id);
+	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	// take the hard decision
+	for (auto i = 0; i < this->K; i++)
+	{
+		const auto k = this->info_bits_pos[i];
+		V_K[i] = !(this->Lp_N[k] >= 0);
+	}
+
+	// set the flag so C_to_V structure can be reset to 0 only at the beginning of the loop in iterative decoding
+	if (frame_id == Decoder<B,R>::n_frames -1)
+		this->init_flag = true;
+
+	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+	this->d_load_total  += d_load;
+	this->d_decod_total += d_decod;
+	this->d_store_total += d_store;
+}
+
+// BP algorithm
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled<B,R>
+::BP_decode(const R *Y_N, const int frame_id)
+{
+	auto &C_to_V = this->C_to_V[frame_id];
+
+	// the variable nodes messages from the channel and the C_to_V messages of the previous turbo iteration
+	for (auto v = 0; v < this->n_V_nodes; v++)
+	{
+		auto sum_C_to_V = (R)0;
+		for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+			sum_C_to_V += C_to_V[k];
+
+		const auto app = Y_N[v] + sum_C_to_V;
+		this->Lp_N[v] = app;
+
+		for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+			this->V_to_C[this->VN_to_branch[k]] = app - C_to_V[k];
+	}
+
+	if (this->n_threads > 1)
+	{
+		// the threads of the team call the virtual 'BP_process': they can't be created in the constructor
+		if (this->team.empty())
+			for (auto t = 1; t < this->n_threads; t++)
+				this->team.push_back(std::thread(&Decoder_LDPC_BP_shuffled<B,R>::team_loop, this, t));
+
+		{
+			std::lock_guard<std::mutex> lock(this->team_mutex);
+			this->team_frame_id = frame_id;
+			this->team_Y_N      = Y_N;
+			this->team_job++;
+		}
+		this->team_cond.notify_all();
+	}
+
+	// the calling thread is the thread 0 of the team
+	this->BP_decode_team(Y_N, frame_id, 0);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled<B,R>
+::BP_decode_team(const R *Y_N, const int frame_id, const int tid)
+{
+	auto &C_to_V = this->C_to_V[frame_id];
+
+	auto cur_syndrome_depth = 0;
+
+	for (auto ite = 0; ite < this->n_ite; ite++)
+	{
+		// specific check node update rule (min-sum or sum-product for example)
+		this->BP_process(Y_N, C_to_V, tid);
+
+		// stop criterion (checked by the thread 0, the other threads wait for the result)
+		if (this->enable_syndrome)
+		{
+			if (tid == 0)
+				this->team_syndrome = this->syndrome.check(this->Lp_N.data());
+			if (this->n_threads > 1)
+				this->team_barrier(tid);
+		}
+
+		if (this->enable_syndrome && this->team_syndrome)
+		{
+			cur_syndrome_depth++;
+			if (cur_syndrome_depth == this->syndrome_depth)
+				break;
+		}
+		else
+			cur_syndrome_depth = 0;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_shuffled<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_shuffled<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_shuffled<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_shuffled<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_shuffled<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
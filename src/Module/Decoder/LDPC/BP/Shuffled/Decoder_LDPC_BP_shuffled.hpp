@@ -0,0 +1,129 @@
+#ifndef DECODER_LDPC_BP_SHUFFLED_HPP_
+#define DECODER_LDPC_BP_SHUFFLED_HPP_
+
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+#include "../../../Decoder_SISO.hpp"
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
+#include "Tools/Threads/Spin_barrier.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Column-layered (shuffled) BP: the variable nodes are processed group after group (of 'group_size' variable nodes)
+ * and the messages of a group are sent to the check nodes before the next group is processed, so the next groups
+ * already see them in the same iteration (the flooding schedule is the case of a single group of N variable nodes).
+ * The variable nodes of a group are independent from each other: they only read the states of the check nodes and
+ * the old V_to_C messages are buffered, then the states of the check nodes connected to the group are merged (a check
+ * node which receives a single new message of the group is updated, the other ones are computed again).
+ *
+ * A frame can be decoded by a team of 'n_threads' threads (the calling thread and 'n_threads' - 1 threads created by
+ * the decoder at the first decoding): the variable nodes of a group are shared between the threads, then the check
+ * nodes connected to the group, with a barrier after each step. The threads of the team wait for the next frame on a
+ * condition variable.
+ *
+ * The derived classes give the check node update rule with 3 functions called by 'BP_process_groups' (without virtual
+ * calls): 'CN_init' computes the state of a check node from its incoming messages, 'CN_message' returns the message
+ * sent to a variable node by a check node (from the state of the check node) and 'CN_update' updates the state when an
+ * incoming message changes.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_shuffled : public Decoder_SISO<B,R>
+{
+protected:
+	const int  n_ite;      // number of iterations to perform
+	const int  n_V_nodes;  // number of variable nodes (= N)
+	const int  n_C_nodes;  // number of check    nodes (= N - K)
+	const int  n_branches; // number of branches in the bi-partite graph (connexions between the V and C nodes)
+	const int  group_size; // number of variable nodes per group
+
+	const bool enable_syndrome;
+	const int  syndrome_depth;
+
+	// reset so C_to_V structure can be cleared only at the beginning of the loop in iterative decoding
+	bool init_flag;
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	// the V_to_C messages are stored check node by check node: the messages to the check node 'c' are
+	// [CN_offsets[c], CN_offsets[c +1][, and the C_to_V messages variable node by variable node: the messages to the
+	// variable node 'v' are [VN_offsets[v], VN_offsets[v +1][ (coming from the check nodes 'VN_to_CN', the
+	// corresponding V_to_C messages are 'VN_to_branch')
+	std::vector<unsigned> CN_offsets;
+	std::vector<unsigned> VN_offsets;
+	std::vector<unsigned> VN_to_CN;
+	std::vector<unsigned> VN_to_branch;
+
+	// the check nodes connected to the group 'g' are [group_offsets[g], group_offsets[g +1][ in 'group_CN', 'group_k'
+	// gives the position in C_to_V of the single message of the group to the check node ('n_branches' when the group
+	// sends several messages to the check node)
+	std::vector<unsigned> group_offsets;
+	std::vector<unsigned> group_CN;
+	std::vector<unsigned> group_k;
+
+	tools::LDPC_syndrome syndrome; // parity checks of the hard decisions of 'Lp_N'
+
+	// data structures for iterative decoding
+	            mipp::vector<R>  Lp_N;       // a posteriori information
+	std::vector<mipp::vector<R>> C_to_V;     // check    nodes to variable nodes messages (kept for the turbo decoding)
+	            mipp::vector<R>  V_to_C;     // variable nodes to check    nodes messages
+	            mipp::vector<R>  V_to_C_old; // V_to_C messages before the update of the group (in the C_to_V order)
+
+	// team of threads decoding the same frame (the thread 0 is the calling thread)
+	const int                n_threads;
+	std::vector<std::thread> team;
+	tools::Spin_barrier      team_barrier;  // synchronization of the threads between the steps of a group
+	std::mutex               team_mutex;
+	std::condition_variable  team_cond;
+	int                      team_job;      // incremented to start the decoding of 'team_frame_id' by the team
+	int                      team_frame_id;
+	const R                 *team_Y_N;
+	bool                     team_stop;     // the threads of the team exit
+	bool                     team_syndrome; // result of the syndrome check of the current iteration (by the thread 0)
+
+	Decoder_LDPC_BP_shuffled(const int &K, const int &N, const int& n_ite,
+	                         const tools::Sparse_matrix &H,
+	                         const std::vector<unsigned> &info_bits_pos,
+	                         const bool enable_syndrome = true,
+	                         const int syndrome_depth = 1,
+	                         const int n_frames = 1,
+	                         const int group_size = 1,
+	                         const int n_threads = 1,
+	                         const std::string name = "Decoder_LDPC_BP_shuffled");
+	virtual ~Decoder_LDPC_BP_shuffled();
+
+	// soft decode
+	void _soft_decode(const R *Y_N1, R *Y_N2, const int frame_id);
+
+	// hard decoder
+	void _hard_decode(const R *Y_N, B *V_K, const int frame_id);
+
+	// BP functions for decoding
+	void BP_decode(const R *Y_N, const int frame_id);
+
+	// the iterations of the thread 'tid' of the team
+	void BP_decode_team(const R *Y_N, const int frame_id, const int tid);
+
+	// one iteration (the part of the thread 'tid' of the team)
+	virtual void BP_process(const R *Y_N, mipp::vector<R> &C_to_V, const int tid) = 0;
+
+	// one iteration with the check node update rule of 'D' (a derived class)
+	template <class D>
+	void BP_process_groups(D &rule, const R *Y_N, mipp::vector<R> &C_to_V, const int tid);
+
+private:
+	// main loop of the threads 1 to 'n_threads' - 1 of the team
+	void team_loop(const int tid);
+};
+}
+}
+
+#include "Decoder_LDPC_BP_shuffled.hxx"
+
+#endif /* DECODER_LDPC_BP_SHUFFLED_HPP_ */
@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_shuffled.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R>
+template <class D>
+void Decoder_LDPC_BP_shuffled<B,R>
+::BP_process_groups(D &rule, const R *Y_N, mipp::vector<R> &C_to_V, const int tid)
+{
+	const auto n_groups = (int)this->group_offsets.size() -1;
+
+	// the states of the check nodes are computed again at each iteration (no accumulation of the rounding errors of
+	// the updates)
+	const auto first_CN = (tid +0) * this->n_C_nodes / this->n_threads;
+	const auto last_CN  = (tid +1) * this->n_C_nodes / this->n_threads;
+	for (auto c = first_CN; c < last_CN; c++)
+		rule.CN_init(c);
+
+	if (this->n_threads > 1)
+		this->team_barrier(tid);
+
+	for (auto g = 0; g < n_groups; g++)
+	{
+		const auto first    = g * this->group_size;
+		const auto n_VN     = std::min(this->group_size, this->n_V_nodes - first);
+		const auto first_VN = first + (tid +0) * n_VN / this->n_threads;
+		const auto last_VN  = first + (tid +1) * n_VN / this->n_threads;
+
+		// the variable nodes of the thread receive the messages of their check nodes and update their messages (the
+		// states of the check nodes are only read, the old messages are kept for the merge)
+		for (auto v = first_VN; v < last_VN; v++)
+		{
+			auto sum_C_to_V = (R)0;
+			for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+			{
+				C_to_V[k] = rule.CN_message(this->VN_to_CN[k], this->VN_to_branch[k]);
+				sum_C_to_V += C_to_V[k];
+			}
+
+			const auto app = Y_N[v] + sum_C_to_V;
+			this->Lp_N[v] = app;
+
+			for (auto k = this->VN_offsets[v]; k < this->VN_offsets[v +1]; k++)
+			{
+				const auto b = this->VN_to_branch[k];
+
+				this->V_to_C_old[k] = this->V_to_C[b];
+				this->V_to_C    [b] = app - C_to_V[k];
+			}
+		}
+
+		if (this->n_threads > 1)
+			this->team_barrier(tid);
+
+		// the states of the check nodes connected to the group are merged (each check node by a single thread)
+		const auto n_CN    = (int)(this->group_offsets[g +1] - this->group_offsets[g]);
+		const auto first_i = this->group_offsets[g] + (tid +0) * n_CN / this->n_threads;
+		const auto last_i  = this->group_offsets[g] + (tid +1) * n_CN / this->n_threads;
+		for (auto i = first_i; i < last_i; i++)
+		{
+			const auto c = this->group_CN[i];
+			const auto k = this->group_k [i];
+
+			if (k != (unsigned)this->n_branches)
+				rule.CN_update(c, this->VN_to_branch[k], this->V_to_C_old[k]);
+			else
+				rule.CN_init(c); // several messages of the group have changed
+		}
+
+		if (this->n_threads > 1)
+			this->team_barrier(tid);
+	}
+}
+}
+}
@@ -0,0 +1,109 @@
+#include <typeinfo>
+#include <limits>
+#include <cmath>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Math/utils.h"
+
+#include "Decoder_LDPC_BP_shuffled_log_sum_product.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_shuffled_log_sum_product<B,R>
+::Decoder_LDPC_BP_shuffled_log_sum_product(const int &K, const int &N, const int& n_ite,
+                                           const Sparse_matrix &H,
+                                           const std::vector<unsigned> &info_bits_pos,
+                                           const bool enable_syndrome,
+                                           const int syndrome_depth,
+                                           const int n_frames,
+                                           const int group_size,
+                                           const int n_threads,
+                                           const std::string name)
+: Decoder_LDPC_BP_shuffled<B,R>(K, N, n_ite, H, info_bits_pos, enable_syndrome, syndrome_depth, n_frames, group_size,
+                                n_threads, name),
+  values(H.get_n_connections()), CN_sum(H.get_n_cols()), CN_sign(H.get_n_cols())
+{
+	if (typeid(R) != typeid(float) && typeid(R) != typeid(double))
+		throw runtime_error(__FILE__, __LINE__, __func__, "This decoder only supports floating-point LLRs.");
+}
+
+template <typename B, typename R>
+Decoder_LDPC_BP_shuffled_log_sum_product<B,R>
+::~Decoder_LDPC_BP_shuffled_log_sum_product()
+{
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled_log_sum_product<B,R>
+::BP_process(const R *Y_N, mipp::vector<R> &C_to_V, const int tid)
+{
+	this->BP_process_groups(*this, Y_N, C_to_V, tid);
+}
+
+template <typename R>
+inline R log_tanh(const R value)
+{
+	const auto tan_v_abs = std::tanh((R)std::abs(value) * (R)0.5);
+	return (tan_v_abs != 0) ? (R)std::log(tan_v_abs) : std::numeric_limits<R>::min();
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled_log_sum_product<B,R>
+::CN_init(const int c)
+{
+	auto sign =    0;
+	auto sum  = (R)0;
+
+	for (auto b = this->CN_offsets[c]; b < this->CN_offsets[c +1]; b++)
+	{
+		const auto value = this->V_to_C[b];
+		const auto res   = log_tanh<R>(value);
+
+		sign ^= std::signbit((float)value) ? -1 : 0;
+		sum  += res;
+		this->values[b] = res;
+	}
+
+	this->CN_sign[c] = sign;
+	this->CN_sum [c] = sum;
+}
+
+template <typename B, typename R>
+R Decoder_LDPC_BP_shuffled_log_sum_product<B,R>
+::CN_message(const int c, const unsigned branch) const
+{
+	const auto value = this->V_to_C[branch];
+	const auto v_sig = this->CN_sign[c] ^ (std::signbit((float)value) ? -1 : 0);
+	// the sum is updated incrementally so the rounding errors can give a value greater than 1
+	      auto exp   = (R)std::exp(this->CN_sum[c] - this->values[branch]);
+	           exp   = (exp < (R)1.0) ? exp : (R)1.0 - std::numeric_limits<R>::epsilon();
+	const auto v_tan = (R)2.0 * std::atanh(exp);
+
+	return (R)std::copysign(v_tan, v_sig);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_shuffled_log_sum_product<B,R>
+::CN_update(const int c, const unsigned branch, const R old_V_to_C)
+{
+	const auto value = this->V_to_C[branch];
+	const auto res   = log_tanh<R>(value);
+
+	this->CN_sign[c] ^= (std::signbit((float)old_V_to_C) ? -1 : 0) ^ (std::signbit((float)value) ? -1 : 0);
+	this->CN_sum [c] += res - this->values[branch];
+	this->values[branch] = res;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_shuffled_log_sum_product<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_shuffled_log_sum_product<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_shuffled_log_sum_product<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_shuffled_log_sum_product<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_shuffled_log_sum_product<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,49 @@
+#ifndef DECODER_LDPC_BP_SHUFFLED_LOG_SUM_PRODUCT_HPP_
+#define DECODER_LDPC_BP_SHUFFLED_LOG_SUM_PRODUCT_HPP_
+
+#include "../Decoder_LDPC_BP_shuffled.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_shuffled_log_sum_product : public Decoder_LDPC_BP_shuffled<B,R>
+{
+	friend class Decoder_LDPC_BP_shuffled<B,R>;
+
+private:
+	// state of the check nodes: the sum of the log of the tanh of the incoming half magnitudes and the product of the
+	// signs ('values' are the log of the tanh of the incoming half magnitudes)
+	mipp::vector<R>  values;
+	mipp::vector<R>  CN_sum;
+	std::vector<int> CN_sign;
+
+public:
+	Decoder_LDPC_BP_shuffled_log_sum_product(const int &K, const int &N, const int& n_ite,
+	                                         const tools::Sparse_matrix &H,
+	                                         const std::vector<unsigned> &info_bits_pos,
+	                                         const bool enable_syndrome = true,
+	                                         const int syndrome_depth = 1,
+	                                         const int n_frames = 1,
+	                                         const int group_size = 1,
+	                                         const int n_threads = 1,
+	                                         const std::string name = "Decoder_LDPC_BP_shuffled_log_sum_product");
+	virtual ~Decoder_LDPC_BP_shuffled_log_sum_product();
+
+protected:
+	// BP functions for decoding
+	void BP_process(const R *Y_N, mipp::vector<R> &C_to_V, const int tid);
+
+	// check node update rule
+	inline void CN_init   (const int c);
+	inline R    CN_message(const int c, const unsigned branch) const;
+	inline void CN_update (const int c, const unsigned branch, const R old_V_to_C);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_shuffled_LSPA = Decoder_LDPC_BP_shuffled_log_sum_product<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_SHUFFLED_LOG_SUM_PRODUCT_HPP_ */
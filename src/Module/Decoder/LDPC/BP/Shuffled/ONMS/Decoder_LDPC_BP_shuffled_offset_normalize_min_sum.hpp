@@ -0,0 +1,55 @@
+#ifndef DECODER_LDPC_BP_SHUFFLED_MIN_SUM_OFFSET_HPP_
+#define DECODER_LDPC_BP_SHUFFLED_MIN_SUM_OFFSET_HPP_
+
+#include "../Decoder_LDPC_BP_shuffled.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_shuffled_offset_normalize_min_sum : public Decoder_LDPC_BP_shuffled<B,R>
+{
+	friend class Decoder_LDPC_BP_shuffled<B,R>;
+
+private:
+	const float normalize_factor;
+	const R offset;
+
+	// state of the check nodes: the two smallest magnitudes of the incoming messages, the branch of the smallest one
+	// and the product of the signs
+	mipp::vector<R>       CN_min1;
+	mipp::vector<R>       CN_min2;
+	std::vector<unsigned> CN_min1_branch;
+	std::vector<int>      CN_sign;
+
+public:
+	Decoder_LDPC_BP_shuffled_offset_normalize_min_sum(const int &K, const int &N, const int& n_ite,
+	                                                  const tools::Sparse_matrix &H,
+	                                                  const std::vector<unsigned> &info_bits_pos,
+	                                                  const float normalize_factor = 1.f,
+	                                                  const R offset = (R)0,
+	                                                  const bool enable_syndrome = true,
+	                                                  const int syndrome_depth = 1,
+	                                                  const int n_frames = 1,
+	                                                  const int group_size = 1,
+	                                                  const int n_threads = 1,
+	                                                  const std::string name = "Decoder_LDPC_BP_shuffled_offset_normalize_min_sum");
+	virtual ~Decoder_LDPC_BP_shuffled_offset_normalize_min_sum();
+
+protected:
+	// BP functions for decoding
+	void BP_process(const R *Y_N, mipp::vector<R> &C_to_V, const int tid);
+
+	// check node update rule
+	inline void CN_init   (const int c);
+	inline R    CN_message(const int c, const unsigned branch) const;
+	inline void CN_update (const int c, const unsigned branch, const R old_V_to_C);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_shuffled_ONMS = Decoder_LDPC_BP_shuffled_offset_normalize_min_sum<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_SHUFFLED_MIN_SUM_OFFSET_HPP_ */
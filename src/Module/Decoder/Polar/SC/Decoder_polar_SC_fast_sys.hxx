@@ -242,7 +242,7 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 
 		if (!fast_interleave)
 		{
-			std::vector<const R*> frames(n_frames);
+			std::array<const R*,n_frames> frames;
 			for (auto f = 0; f < n_frames; f++)
 				frames[f] = Y_N + f*this->N;
 			tools::Reorderer_static<R,n_frames>::apply(frames, l.data(), this->N);
@@ -378,7 +378,7 @@ void Decoder_polar_SC_fast_sys<B,R,API_polar>
 			                              this->s.data(), this->s_bis.data());
 
 			// transpose without bit packing (vectorized)
-			std::vector<B*> frames(n_frames);
+			std::array<B*,n_frames> frames;
 			for (auto f = 0; f < n_frames; f++)
 				frames[f] = (B*)(V_K + f*this->K);
 			tools::Reorderer_static<B,n_frames>::apply_rev(s_bis.data(), frames, this->K);
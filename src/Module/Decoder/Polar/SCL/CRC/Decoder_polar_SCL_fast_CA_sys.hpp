@@ -1,6 +1,9 @@
 #ifndef DECODER_POLAR_SCL_FAST_SYS_CA
 #define DECODER_POLAR_SCL_FAST_SYS_CA
 
+#include <vector>
+#include <cstdint>
+
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Module/CRC/CRC.hpp"
@@ -26,6 +29,13 @@ protected:
 	CRC<B>& crc;
 	mipp::vector<B> U_test;
 
+	// incremental CRC: the CRC syndrome is linear in the partial sums, each path carries its own register which is
+	// updated when the bits of a leaf are decided and which is duplicated with the path
+	const bool            incremental_crc; // false if the CRC is too long to fit in a register ('crc.get_size()' > 64)
+	std::vector<uint64_t> crc_weights;     // contribution of each leaf bit to the CRC register (size N)
+	std::vector<uint64_t> crc_states;      // CRC register of each path (size L)
+	uint64_t              crc_target;      // value of the register when the CRC is verified
+
 public:
 	Decoder_polar_SCL_fast_CA_sys(const int& K, const int& N, const int& L, const mipp::vector<B>& frozen_bits, CRC<B>& crc,
 	                              const int n_frames = 1, const std::string name = "Decoder_polar_SCL_fast_CA_sys");
@@ -43,6 +53,13 @@ protected:
 
 	virtual void init_buffers();
 	virtual void _store(B *V_K) const;
+
+	virtual void update_path_states(const int off_s,    const int n_elmts );
+	virtual void copy_path_state   (const int old_path, const int new_path);
+
+private:
+	void init_crc_weights ();
+	void transpose_combine(uint64_t *weights, const int off_s, const int rev_depth, int &node_id);
 };
 }
 }
@@ -1,4 +1,5 @@
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Code/Polar/fb_extract.h"
@@ -14,7 +15,8 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 ::Decoder_polar_SCL_fast_CA_sys(const int& K, const int& N, const int& L, const mipp::vector<B>& frozen_bits,
                                 CRC<B>& crc, const int n_frames, const std::string name)
 : Decoder_polar_SCL_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, n_frames, name),
-  fast_store(false), crc(crc), U_test(K)
+  fast_store(false), crc(crc), U_test(K),
+  incremental_crc(crc.get_size() <= 64), crc_weights(N, 0), crc_states(L, 0), crc_target(0)
 {
 	if (crc.get_size() > K)
 	{
@@ -23,6 +25,9 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 		        << ", 'K' = " << K << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	if (incremental_crc)
+		this->init_crc_weights();
 }
 
 template <typename B, typename R, class API_polar>
@@ -32,7 +37,8 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
                                 const int idx_r0, const int idx_r1,
                                 CRC<B>& crc, const int n_frames, const std::string name)
 : Decoder_polar_SCL_fast_sys<B,R,API_polar>(K, N, L, frozen_bits, polar_patterns, idx_r0, idx_r1, n_frames, name),
-  fast_store(false), crc(crc), U_test(K)
+  fast_store(false), crc(crc), U_test(K),
+  incremental_crc(crc.get_size() <= 64), crc_weights(N, 0), crc_states(L, 0), crc_target(0)
 {
 	if (crc.get_size() > K)
 	{
@@ -41,6 +47,109 @@ Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 		        << ", 'K' = " << K << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	if (incremental_crc)
+		this->init_crc_weights();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::init_crc_weights()
+{
+	const auto K_info   = this->K - crc.get_size();
+	const auto n_frames = crc.get_n_frames();
+
+	// the CRC is affine in the information bits: the register value of the all-zero word is the reference value and
+	// the contribution of each information bit is the register value of a unit word XORed with the reference
+	mipp::vector<B> U_K1( K_info                   * n_frames, 0);
+	mipp::vector<B> U_K2((K_info + crc.get_size()) * n_frames, 0);
+
+	auto pack_crc = [&]() -> uint64_t
+	{
+		uint64_t reg = 0;
+		for (auto i = 0; i < crc.get_size(); i++)
+			reg |= (uint64_t)(U_K2[K_info +i] != 0) << i;
+		return reg;
+	};
+
+	crc.build(U_K1, U_K2);
+	crc_target = pack_crc();
+
+	// weights in the systematic domain (positions of the information bits in the codeword)
+	std::fill(crc_weights.begin(), crc_weights.end(), (uint64_t)0);
+	auto k = 0;
+	for (auto i = 0; i < this->N; i++)
+		if (!this->frozen_bits[i])
+		{
+			if (k < K_info)
+			{
+				U_K1[k] = 1;
+				crc.build(U_K1, U_K2);
+				U_K1[k] = 0;
+
+				crc_weights[i] = pack_crc() ^ crc_target;
+			}
+			else
+				crc_weights[i] = (uint64_t)1 << (k - K_info);
+			k++;
+		}
+
+	// move the weights to the leaves: the partial sums of the leaves are combined by XORs up to the root, the
+	// transposed combinations are applied from the root down to the leaves
+	int node_id = 0;
+	this->transpose_combine(crc_weights.data(), 0, this->m, node_id);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::transpose_combine(uint64_t *weights, const int off_s, const int rev_depth, int &node_id)
+{
+	const int n_elmts = 1 << rev_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	// same tree traversal as in the 'recursive_decode' method
+	if (rev_depth == this->m || (!is_terminal_pattern && rev_depth))
+	{
+		// the transposition of "s[left] ^= s[right]" is "w[right] ^= w[left]"
+		for (auto i = 0; i < n_elm_2; i++)
+			weights[off_s + n_elm_2 +i] ^= weights[off_s +i];
+
+		this->transpose_combine(weights, off_s,           rev_depth -1, ++node_id);
+		this->transpose_combine(weights, off_s + n_elm_2, rev_depth -1, ++node_id);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::update_path_states(const int off_s, const int n_elmts)
+{
+	if (!incremental_crc)
+		return;
+
+	const auto weights = crc_weights.data() + off_s;
+	for (auto i = 0; i < this->n_active_paths; i++)
+	{
+		const auto path = this->paths[i];
+		const auto bits = this->s[path].data() + off_s;
+
+		auto reg = crc_states[path];
+		for (auto j = 0; j < n_elmts; j++)
+			reg ^= weights[j] & -(uint64_t)(bits[j] != 0);
+		crc_states[path] = reg;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
+::copy_path_state(const int old_path, const int new_path)
+{
+	crc_states[new_path] = crc_states[old_path];
 }
 
 template <typename B, typename R, class API_polar>
@@ -63,10 +172,19 @@ int Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 		});
 
 	auto i = 0;
-	while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]])) i++;
+	if (incremental_crc)
+	{
+		// O(1) check per path, the best path is extracted in the '_store' method
+		while (i < this->n_active_paths && crc_states[this->paths[i]] != crc_target) i++;
+		fast_store = false;
+	}
+	else
+	{
+		while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]])) i++;
+		fast_store = i != this->n_active_paths;
+	}
 
 	this->best_path = (i == this->n_active_paths) ? this->paths[0] : this->paths[i];
-	fast_store = i != this->n_active_paths;
 
 	return this->n_active_paths -i;
 }
@@ -77,6 +195,7 @@ void Decoder_polar_SCL_fast_CA_sys<B,R,API_polar>
 {
 	Decoder_polar_SCL_fast_sys<B,R,API_polar>::init_buffers();
 	fast_store = false;
+	std::fill(crc_states.begin(), crc_states.end(), (uint64_t)0);
 }
 
 template <typename B, typename R, class API_polar>
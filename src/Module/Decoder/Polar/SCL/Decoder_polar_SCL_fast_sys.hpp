@@ -84,6 +84,9 @@ protected:
 	virtual inline int  select_best_path(                             );
 	        inline int  up_ref_array_idx(const int path, const int r_d); // return the array
 
+	virtual inline void update_path_states(const int off_s,    const int n_elmts ); // the bits of a leaf are decided
+	virtual inline void copy_path_state   (const int old_path, const int new_path); // a path has been duplicated
+
 private:
 	inline void flip_bits_r1 (const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
 	inline void flip_bits_spc(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
@@ -592,6 +592,8 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 			dup_count[path]--;
 		}
+
+		this->update_path_states(off_s, n_elmts);
 	}
 }
 
@@ -676,6 +678,8 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 			dup_count[path]--;
 		}
+
+		this->update_path_states(off_s, N_ELMTS);
 	}
 }
 
@@ -779,6 +783,8 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 			dup_count[path] = 0;
 		}
 	}
+
+	this->update_path_states(off_s, n_elmts);
 }
 
 template <typename B, typename R, class API_polar>
@@ -855,6 +861,8 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 			dup_count[path] = 0;
 		}
 	}
+
+	this->update_path_states(off_s, N_ELMTS);
 }
 
 template <typename B, typename R, class API_polar>
@@ -966,6 +974,8 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 		dup_count[path]--;
 	}
+
+	this->update_path_states(off_s, n_elmts);
 }
 
 template <typename B, typename R, class API_polar>
@@ -1078,6 +1088,8 @@ void Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 		dup_count[path]--;
 	}
+
+	this->update_path_states(off_s, N_ELMTS);
 }
 
 template <typename B, typename R, class API_polar>
@@ -1216,7 +1228,21 @@ int Decoder_polar_SCL_fast_sys<B,R,API_polar>
 
 	std::copy(s[old_path].begin(), s[old_path].begin() + off_s + n_elmts, s[new_path].begin());
 
+	this->copy_path_state(old_path, new_path);
+
 	return new_path;
 }
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::update_path_states(const int off_s, const int n_elmts)
+{
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCL_fast_sys<B,R,API_polar>
+::copy_path_state(const int old_path, const int new_path)
+{
+}
 }
 }
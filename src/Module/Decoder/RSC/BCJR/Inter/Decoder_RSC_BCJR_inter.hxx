@@ -146,7 +146,7 @@ void Decoder_RSC_BCJR_inter<B,R>
 		constexpr auto n_frames = mipp::nElReg<R>();
 		const auto frame_size = 2*this->K + tail;
 
-		std::vector<const R*> frames(n_frames);
+		std::array<const R*,n_frames> frames;
 		for (auto f = 0; f < n_frames; f++)
 			frames[f] = Y_N + f*frame_size;
 		tools::Reorderer_static<R,n_frames>::apply(frames, this->sys.data(), this->K);
@@ -176,7 +176,7 @@ void Decoder_RSC_BCJR_inter<B,R>
 	{
 		constexpr auto n_frames = mipp::nElReg<B>();
 
-		std::vector<B*> frames(n_frames);
+		std::array<B*,n_frames> frames;
 		for (auto f = 0; f < n_frames; f++)
 			frames[f] = V_K + f*this->K;
 		tools::Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->K);
@@ -47,7 +47,7 @@ void Decoder_turbo_fast<B,R>
 		{
 			constexpr auto n_frames = mipp::nElReg<R>();
 
-			std::vector<const R*> frames(n_frames);
+			std::array<const R*,n_frames> frames;
 			for (auto f = 0; f < n_frames; f++)
 				frames[f] = Y_N + f*frame_size;
 			Reorderer_static<R,n_frames>::apply(frames, this->l_sn.data(), this->K);
@@ -84,7 +84,7 @@ void Decoder_turbo_fast<B,R>
 		{
 			constexpr auto n_frames = mipp::nElReg<R>() / 8;
 
-			std::vector<const R*> frames(n_frames);
+			std::array<const R*,n_frames> frames;
 			for (auto f = 0; f < n_frames; f++)
 				frames[f] = Y_N + f*frame_size;
 			Reorderer_static<R,n_frames>::apply(frames, this->l_sn.data(), this->K);
@@ -239,7 +239,7 @@ void Decoder_turbo_fast<B,R>
 		{
 			constexpr auto n_frames = mipp::nElReg<B>();
 
-			std::vector<B*> frames(n_frames);
+			std::array<B*,n_frames> frames;
 			for (auto f = 0; f < n_frames; f++)
 				frames[f] = V_K + f*this->K;
 			Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->K);
@@ -248,7 +248,7 @@ void Decoder_turbo_fast<B,R>
 		{
 			constexpr auto n_frames = mipp::nElReg<B>() / 8;
 
-			std::vector<B*> frames(n_frames);
+			std::array<B*,n_frames> frames;
 			for (auto f = 0; f < n_frames; f++)
 				frames[f] = V_K + f*this->K;
 			Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->K);
@@ -1,5 +1,8 @@
 #include <vector>
 #include <cmath>
+#include <algorithm>
+
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Encoder_BCH.hpp"
 
@@ -9,42 +12,149 @@ using namespace aff3ct::tools;
 template <typename B>
 Encoder_BCH<B>
 ::Encoder_BCH(const int& K, const int& N, const Galois &GF, const int n_frames, const std::string name)
- : Encoder<B>(K, N, n_frames, name), m(GF.get_m()), g(N - K + 1), bb(N - K)
+ : Encoder<B>(K, N, n_frames, name), m(GF.get_m()), g(N - K + 1),
+   n_rdncy_words(Bit_packer<B>::n_words(N - K)),
+   n_lut(N - K >= 64 ? 8 : (N - K >= 8 ? 1 : 0)),
+   g_words(n_rdncy_words, 0),
+   lut    (n_lut * 256 * n_rdncy_words, 0),
+   U_words(Bit_packer<B>::n_words(K)),
+   rdncy  (n_rdncy_words)
 {
 	// set polynomial coefficients
 	this->g = GF.g;
+
+	const auto n_rdncy = N - K;
+	for (auto j = 0; j < n_rdncy; j++)
+		if (g[j] != 0)
+			g_words[j >> 6] |= (uint64_t)1 << (j & 63);
+
+	// x^(N-K + i) modulo g(x) for the 8 * 'n_lut' bits of a step, then the remainder of each byte value is the XOR of
+	// the remainders of its bits
+	std::vector<uint64_t> x_pow(8 * n_lut * n_rdncy_words);
+	std::fill(rdncy.begin(), rdncy.end(), (uint64_t)0);
+	for (auto i = 0; i < 8 * n_lut; i++)
+	{
+		this->bit_step(i == 0 ? 1 : 0); // x^(N-K) for the first bit, then multiplications by x
+		std::copy(rdncy.begin(), rdncy.end(), x_pow.begin() + i * n_rdncy_words);
+	}
+
+	for (auto l = 0; l < n_lut; l++)
+		for (auto v = 1; v < 256; v++)
+		{
+			auto b = 0; // lowest bit of 'v', the other bits have already been computed
+			while (!((v >> b) & 1))
+				b++;
+
+			const auto entry  = lut  .data() + (l * 256 + v           ) * n_rdncy_words;
+			const auto others = lut  .data() + (l * 256 + (v & (v -1))) * n_rdncy_words;
+			const auto bit    = x_pow.data() + (l * 8 + b             ) * n_rdncy_words;
+			for (auto w = 0; w < n_rdncy_words; w++)
+				entry[w] = others[w] ^ bit[w];
+		}
+}
+
+template <typename B>
+uint64_t Encoder_BCH<B>
+::top_bits(const int n) const
+{
+	// bits [N-K - n, N-K[ of the register (n <= 64)
+	const auto pos = this->N - this->K - n;
+	const auto lo  = pos >> 6;
+	const auto sh  = pos & 63;
+
+	auto v = rdncy[lo] >> sh;
+	if (sh && lo +1 < n_rdncy_words)
+		v |= rdncy[lo +1] << (64 - sh);
+
+	return n == 64 ? v : v & (((uint64_t)1 << n) -1);
 }
 
 template <typename B>
 void Encoder_BCH<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
+::shift_left(const int n)
 {
-	for (auto i = 0; i < this->N - this->K; i++)
-		bb[i] = (B)0;
-	for (auto i = this->K - 1; i >= 0; i--)
+	// multiplication of the register by x^n (1 <= n <= 64), the bits above x^(N-K) are dropped
+	if (n == 64)
 	{
-		const auto feedback = U_K[i] ^ bb[this->N - this->K - 1];
-		if (feedback != 0)
+		for (auto w = n_rdncy_words -1; w > 0; w--)
+			rdncy[w] = rdncy[w -1];
+		rdncy[0] = 0;
+	}
+	else
+	{
+		for (auto w = n_rdncy_words -1; w > 0; w--)
+			rdncy[w] = (rdncy[w] << n) | (rdncy[w -1] >> (64 - n));
+		rdncy[0] <<= n;
+	}
+
+	const auto n_top_bits = (this->N - this->K) - (n_rdncy_words -1) * 64;
+	if (n_top_bits < 64)
+		rdncy[n_rdncy_words -1] &= ((uint64_t)1 << n_top_bits) -1;
+}
+
+template <typename B>
+void Encoder_BCH<B>
+::bit_step(const uint64_t bit)
+{
+	const auto feedback = this->top_bits(1) ^ bit;
+	this->shift_left(1);
+	if (feedback)
+		for (auto w = 0; w < n_rdncy_words; w++)
+			rdncy[w] ^= g_words[w];
+}
+
+template <typename B>
+void Encoder_BCH<B>
+::word_step(const uint64_t word)
+{
+	if (n_lut == 8)
+	{
+		const auto v = this->top_bits(64) ^ word;
+		this->shift_left(64);
+		for (auto l = 0; l < 8; l++)
 		{
-			for (auto j = this->N - this->K - 1; j > 0; j--)
-				if (g[j] != 0)
-					bb[j] = bb[j - 1] ^ feedback;
-				else
-					bb[j] = bb[j - 1];
-			bb[0] = g[0] && feedback;
+			const auto entry = lut.data() + (l * 256 + ((v >> (8 * l)) & 255)) * n_rdncy_words;
+			for (auto w = 0; w < n_rdncy_words; w++)
+				rdncy[w] ^= entry[w];
 		}
-		else
+	}
+	else if (n_lut == 1)
+	{
+		for (auto l = 7; l >= 0; l--)
 		{
-			for (auto j = this->N - this->K - 1; j > 0; j--)
-				bb[j] = bb[j - 1];
-			bb[0] = 0;
+			const auto v = this->top_bits(8) ^ ((word >> (8 * l)) & 255);
+			this->shift_left(8);
+			const auto entry = lut.data() + v * n_rdncy_words;
+			for (auto w = 0; w < n_rdncy_words; w++)
+				rdncy[w] ^= entry[w];
 		}
 	}
+	else
+	{
+		for (auto b = 63; b >= 0; b--)
+			this->bit_step((word >> b) & 1);
+	}
+}
+
+template <typename B>
+void Encoder_BCH<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	const auto n_rdncy = this->N - this->K;
+
+	Bit_packer<B>::pack_words(U_K, U_words.data(), this->K);
+	std::fill(rdncy.begin(), rdncy.end(), (uint64_t)0);
+
+	// the information bits are divided from the highest degree: the bits of the incomplete last word first, then the
+	// whole words
+	const auto n_full_words = this->K / 64;
+	for (auto i = this->K -1; i >= n_full_words * 64; i--)
+		this->bit_step((U_words[n_full_words] >> (i & 63)) & 1);
+	for (auto w = n_full_words -1; w >= 0; w--)
+		this->word_step(U_words[w]);
 
-	for (auto i = 0; i < this->N - this->K; i++)
-		X_N[i] = bb[i];
-	for (auto i = 0; i < this->K; i++)
-		X_N[i + this->N - this->K] = U_K[i];
+	Bit_packer<B>::unpack_words(rdncy.data(), X_N, n_rdncy);
+	std::copy(U_K, U_K + this->K, X_N + n_rdncy);
 }
 
 // ==================================================================================== explicit template instantiation
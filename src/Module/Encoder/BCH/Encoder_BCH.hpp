@@ -2,6 +2,7 @@
 #define ENCODER_BCH_HPP_
 
 #include <vector>
+#include <cstdint>
 #include <mipp.h>
 
 #include "../Encoder.hpp"
@@ -11,6 +12,17 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Encoder_BCH
+ *
+ * \brief Encodes with a BCH code (systematic, the redundancy bits come first).
+ *
+ * \tparam B: type of the bits in the Encoder.
+ *
+ * The redundancy polynomial x^(N-K) i(x) modulo g(x) is computed on bit-packed words, 64 information bits at a time
+ * (8 bits at a time when N-K < 64): each byte of the register which is shifted out goes through a precomputed table
+ * of its remainder modulo g(x) (the "slicing-by-8" trick of the CRCs).
+ */
 template <typename B = int>
 class Encoder_BCH : public Encoder<B>
 {
@@ -19,7 +31,14 @@ protected:
 	const int m; // order of the Galois Field
 
 	mipp::vector<int> g;  // coefficients of the generator polynomial, g(x)
-	mipp::vector<B  > bb; // coefficients of redundancy polynomial x^(length-k) i(x) modulo g(x)
+
+	const int n_rdncy_words; // number of words of the redundancy register
+	const int n_lut;         // number of tables (8 to process 64 bits at a time, 1 for 8 bits, 0 for 1 bit)
+
+	std::vector<uint64_t> g_words; // g(x) without the x^(N-K) term: x^(N-K) modulo g(x)
+	std::vector<uint64_t> lut;     // 'n_lut' tables of 256 remainders: byte(x) x^(N-K + 8 l) modulo g(x)
+	std::vector<uint64_t> U_words; // bit-packed information bits
+	std::vector<uint64_t> rdncy;   // bit-packed redundancy register
 
 public:
 	Encoder_BCH(const int& K, const int& N, const tools::Galois &GF, const int n_frames = 1,
@@ -29,6 +48,12 @@ public:
 
 protected:
 	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+
+private:
+	inline uint64_t top_bits  (const int n) const;
+	inline void     shift_left(const int n);
+	inline void     bit_step  (const uint64_t bit);
+	inline void     word_step (const uint64_t word);
 };
 }
 }
@@ -1,15 +1,22 @@
+#include <fstream>
 #include <iostream>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/bash_tools.h"
-#include "Tools/Math/matrix.h"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Encoder_LDPC_DVBS2.hpp"
 
 using namespace aff3ct::module;
 using namespace aff3ct::tools;
 
+// a group of 360 information bits (or a row of parity bits) is stored in 6 words, the last word holds 40 bits
+static const int n_grp_bits  = 360;
+static const int n_grp_words = 6;
+static const int n_last_bits = n_grp_bits - (n_grp_words -1) * 64;
+
 template <typename B>
 Encoder_LDPC_DVBS2<B>
 ::Encoder_LDPC_DVBS2(const int K, const int N, const int n_frames, const std::string name)
@@ -20,40 +27,35 @@ Encoder_LDPC_DVBS2<B>
 	if (!dvbs2)
 	{
 		std::stringstream message;
-		message << "The given format doesn't match any known generator matrix ('K' = " << K << ", 'N' = " << N << ").";
+		message << "The given format doesn't match any known generator matrix ('K' = " << K << ", 'N' = " << N << "), "
+		        << "the table of addresses has to be given.";
 		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (K != dvbs2->K_LDPC)
-	{
-		std::stringstream message;
-		message << "'K' has to be equal to 'dvbs2->K_LDPC' ('K' = " << K
-		        << ", 'dvbs2->K_LDPC' = " << dvbs2->K_LDPC << ").";
-		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+	init_dvbs2();
+}
 
-	if (N != dvbs2->N_LDPC)
-	{
-		std::stringstream message;
-		message << "'N' has to be equal to 'dvbs2->N_LDPC' ('N' = " << N
-		        << ", 'dvbs2->N_LDPC' = " << dvbs2->N_LDPC << ").";
-		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-	}
+template <typename B>
+Encoder_LDPC_DVBS2<B>
+::Encoder_LDPC_DVBS2(const int K, const int N, const std::string &table_path, const int n_frames,
+                     const std::string name)
+: Encoder_LDPC<B>(K, N, n_frames, name)
+{
+	read_dvbs2(table_path);
+	init_dvbs2();
 }
 
 template <typename B>
 Encoder_LDPC_DVBS2<B>
 ::~Encoder_LDPC_DVBS2()
 {
-	if (dvbs2)
-		delete dvbs2;
 }
 
 template <typename B>
 void Encoder_LDPC_DVBS2<B>
 ::build_dvbs2()
 {
-	dvbs2 = nullptr;
+	dvbs2.reset();
 
 	auto NmK = this->N - this->K;
 
@@ -64,7 +66,7 @@ void Encoder_LDPC_DVBS2<B>
 			switch (NmK)
 			{
 				case 5400 :
-					dvbs2 = new dvbs2_values_16200_5400();
+					dvbs2.reset(new dvbs2_values_16200_5400());
 					break;
 				default :
 					break;
@@ -76,25 +78,25 @@ void Encoder_LDPC_DVBS2<B>
 			switch (NmK)
 			{
 				case 6480 :
-					dvbs2 = new dvbs2_values_64800_6480();
+					dvbs2.reset(new dvbs2_values_64800_6480());
 					break;
 				case 7200 :
-					dvbs2 = new dvbs2_values_64800_7200();
+					dvbs2.reset(new dvbs2_values_64800_7200());
 					break;
 				case 16200 :
-					dvbs2 = new dvbs2_values_64800_16200();
+					dvbs2.reset(new dvbs2_values_64800_16200());
 					break;
 				case 21600 :
-					dvbs2 = new dvbs2_values_64800_21600();
+					dvbs2.reset(new dvbs2_values_64800_21600());
 					break;
 				case 32400 :
-					dvbs2 = new dvbs2_values_64800_32400();
+					dvbs2.reset(new dvbs2_values_64800_32400());
 					break;
 				case 43200 :
-					dvbs2 = new dvbs2_values_64800_43200();
+					dvbs2.reset(new dvbs2_values_64800_43200());
 					break;
 				case 48600 :
-					dvbs2 = new dvbs2_values_64800_48600();
+					dvbs2.reset(new dvbs2_values_64800_48600());
 					break;
 				default :
 					break;
@@ -108,40 +110,202 @@ void Encoder_LDPC_DVBS2<B>
 
 template <typename B>
 void Encoder_LDPC_DVBS2<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
+::read_dvbs2(const std::string &table_path)
 {
-	std::copy(U_K,           U_K + this->K, X_N);
-	std::fill(X_N + this->K, X_N + this->N, 0  );
+	std::ifstream file(table_path.c_str(), std::ios::in);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Can't open '" << table_path << "' file.";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
-	B* Px = &X_N[this->K];
-	const int *p = dvbs2->EncValues.data();
-	int xPos = 0;
+	// one line per group of information bits, the empty lines and the comments ('#') are skipped
+	std::vector<int> enc_values;
+	int n_lines = 0;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		const auto comment = line.find('#');
+		if (comment != std::string::npos)
+			line.erase(comment);
+
+		std::vector<int> addresses;
+		std::istringstream iss(line);
+		int a;
+		while (iss >> a)
+			addresses.push_back(a);
+
+		if (!iss.eof())
+		{
+			std::stringstream message;
+			message << "The '" << table_path << "' file has to contain lists of integers ('line' = \"" << line
+			        << "\").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (addresses.empty())
+			continue;
+
+		enc_values.push_back((int)addresses.size());
+		enc_values.insert(enc_values.end(), addresses.begin(), addresses.end());
+		n_lines++;
+	}
+
+	std::unique_ptr<dvbs2_values> values(new dvbs2_values());
+	values->EncValues = enc_values;
+	values->N_LDPC    = this->N;
+	values->K_LDPC    = this->K;
+	values->NmK_LDPC  = this->N - this->K;
+	values->M_LDPC    = n_grp_bits;
+	values->Q_LDPC    = (this->N - this->K) / n_grp_bits;
+	values->N_LINES   = n_lines;
+	dvbs2 = std::move(values);
+}
+
+template <typename B>
+void Encoder_LDPC_DVBS2<B>
+::init_dvbs2()
+{
+	if (this->K != dvbs2->K_LDPC)
+	{
+		std::stringstream message;
+		message << "'K' has to be equal to 'dvbs2->K_LDPC' ('K' = " << this->K
+		        << ", 'dvbs2->K_LDPC' = " << dvbs2->K_LDPC << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != dvbs2->N_LDPC)
+	{
+		std::stringstream message;
+		message << "'N' has to be equal to 'dvbs2->N_LDPC' ('N' = " << this->N
+		        << ", 'dvbs2->N_LDPC' = " << dvbs2->N_LDPC << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (dvbs2->M_LDPC != n_grp_bits || dvbs2->Q_LDPC * n_grp_bits != dvbs2->NmK_LDPC)
+	{
+		std::stringstream message;
+		message << "'dvbs2->M_LDPC' has to be equal to " << n_grp_bits << " and 'dvbs2->NmK_LDPC' has to be equal to "
+		        << "'dvbs2->M_LDPC' * 'dvbs2->Q_LDPC' ('dvbs2->M_LDPC' = " << dvbs2->M_LDPC << ", 'dvbs2->Q_LDPC' = "
+		        << dvbs2->Q_LDPC << ", 'dvbs2->NmK_LDPC' = " << dvbs2->NmK_LDPC << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (dvbs2->N_LINES * n_grp_bits != this->K)
+	{
+		std::stringstream message;
+		message << "'dvbs2->N_LINES' * " << n_grp_bits << " has to be equal to 'K' ('dvbs2->N_LINES' = "
+		        << dvbs2->N_LINES << ", 'K' = " << this->K << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 
+	addr_row  .clear();
+	addr_start.clear();
+	grp_offset.assign(1, 0);
+
+	const int *p = dvbs2->EncValues.data();
 	for (int y = 0; y < dvbs2->N_LINES; y++)
 	{
 		int nbPos = (*p++);
 
-		for (int l = 0; l < dvbs2->M_LDPC; l++)
+		for (int q = 0; q < nbPos; q++)
 		{
-			int bit = (int)U_K[xPos];
-			if (bit == 1)
+			if (p[q] < 0 || p[q] >= dvbs2->NmK_LDPC)
 			{
-				for (int q = 0; q < nbPos; q++)
-				{
-					int position  = (p[q] + (xPos % 360) * dvbs2->Q_LDPC) % dvbs2->NmK_LDPC;
-					Px[position] ^= bit;
-				}
+				std::stringstream message;
+				message << "The addresses have to be in [0, 'dvbs2->NmK_LDPC'[ ('address' = " << p[q]
+				        << ", 'dvbs2->NmK_LDPC' = " << dvbs2->NmK_LDPC << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 			}
-			xPos++;
+
+			addr_row  .push_back(p[q] % dvbs2->Q_LDPC);
+			addr_start.push_back(n_grp_bits - p[q] / dvbs2->Q_LDPC);
 		}
+		grp_offset.push_back((unsigned)addr_row.size());
 		p += nbPos;
 	}
 
-	for (int i = 1; i < dvbs2->NmK_LDPC; i++)
-		Px[i] = Px[i] ^ Px[i-1];
+	U_groups.resize(dvbs2->N_LINES * n_grp_words);
+	U_double.resize(2 * n_grp_words);
+	P_rows  .resize(dvbs2->Q_LDPC  * n_grp_words);
+}
+
+template <typename B>
+void Encoder_LDPC_DVBS2<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	std::copy(U_K, U_K + this->K, X_N);
+
+	const auto Q = dvbs2->Q_LDPC;
+
+	Bit_packer<B>::pack_words(U_K, U_groups.data(), n_grp_bits, dvbs2->N_LINES);
+	std::fill(P_rows.begin(), P_rows.end(), (uint64_t)0);
+
+	for (int y = 0; y < dvbs2->N_LINES; y++)
+	{
+		// the group twice in a row: a rotation by 'c' bits is the window of 360 bits starting at the bit '360 - c'
+		const auto u = U_groups.data() + y * n_grp_words;
+		std::copy(u, u + n_grp_words, U_double.begin());
+		U_double[n_grp_words -1] |= u[0] << n_last_bits;
+		for (auto i = 1; i < n_grp_words; i++)
+			U_double[n_grp_words -1 +i] = (u[i -1] >> (64 - n_last_bits)) | (u[i] << n_last_bits);
+		U_double[2 * n_grp_words -1] = u[n_grp_words -1] >> (64 - n_last_bits);
+
+		for (auto a = grp_offset[y]; a < grp_offset[y +1]; a++)
+		{
+			const auto row = P_rows.data() + addr_row[a] * n_grp_words;
+			const auto w   = addr_start[a] >> 6;
+			const auto b   = addr_start[a] & 63;
+
+			if (b)
+				for (auto i = 0; i < n_grp_words; i++)
+					row[i] ^= (U_double[w +i] >> b) | (U_double[w +i +1] << (64 - b));
+			else
+				for (auto i = 0; i < n_grp_words; i++)
+					row[i] ^= U_double[w +i];
+		}
+	}
+
+	// accumulator: a prefix XOR over the parity bits, the column 'c' holds the parity bits [c * Q, (c +1) * Q[. The
+	// prefix XOR is computed over the rows (all the columns at once), then the carry of the previous columns is the
+	// exclusive prefix XOR of the last row
+	for (auto r = 1; r < Q; r++)
+		for (auto i = 0; i < n_grp_words; i++)
+			P_rows[r * n_grp_words +i] ^= P_rows[(r -1) * n_grp_words +i];
+
+	uint64_t carry[n_grp_words];
+	uint64_t c_in = 0;
+	for (auto i = 0; i < n_grp_words; i++)
+	{
+		auto x = P_rows[(Q -1) * n_grp_words +i];
+		if (i == n_grp_words -1)
+			x &= ((uint64_t)1 << n_last_bits) -1;
+
+		x ^= x <<  1;
+		x ^= x <<  2;
+		x ^= x <<  4;
+		x ^= x <<  8;
+		x ^= x << 16;
+		x ^= x << 32;
+		x ^= (uint64_t)0 - c_in;
+
+		carry[i] = (x << 1) | c_in;
+		c_in     = x >> 63;
+	}
+
+	B* Px = &X_N[this->K];
+	for (auto c = 0; c < n_grp_bits; c++)
+	{
+		const auto w  = c >> 6;
+		const auto sh = c & 63;
+		const auto cw = carry[w];
+		for (auto r = 0; r < Q; r++)
+			Px[c * Q + r] = (B)(((P_rows[r * n_grp_words + w] ^ cw) >> sh) & 1);
+	}
 }
 
-// ==================================================================================== explicit template instantiation 
+// ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
 template class aff3ct::module::Encoder_LDPC_DVBS2<B_8>;
@@ -1,7 +1,10 @@
 #ifndef ENCODER_LDPC_DVBS2_HPP_
 #define ENCODER_LDPC_DVBS2_HPP_
 
+#include <string>
 #include <vector>
+#include <memory>
+#include <cstdint>
 #include <mipp.h>
 
 #include "../Encoder_LDPC.hpp"
@@ -16,10 +19,27 @@ namespace module
 template <typename B = int>
 class Encoder_LDPC_DVBS2 : public Encoder_LDPC<B>
 {
-	const dvbs2_values* dvbs2 = nullptr;
+	std::unique_ptr<const dvbs2_values> dvbs2; // released even when the constructor throws
+
+	// the parity bits are stored in 'Q_LDPC' rows of 360 bits (6 words): the parity bit 'c * Q_LDPC + r' is the bit
+	// 'c' of the row 'r'. A table address 'a' of a group of 360 information bits XORs the whole group, rotated by
+	// 'a / Q_LDPC' bits, in the row 'a % Q_LDPC'.
+	std::vector<unsigned> addr_row;   // row of each table address
+	std::vector<unsigned> addr_start; // first bit of the rotated group in the doubled group (360 - 'a / Q_LDPC')
+	std::vector<unsigned> grp_offset; // offsets of the groups in 'addr_row' and 'addr_start' (size: N_LINES +1)
+	std::vector<uint64_t> U_groups;   // bit-packed groups of information bits (6 words per group)
+	std::vector<uint64_t> U_double;   // current group of information bits, twice in a row (720 bits, 12 words)
+	std::vector<uint64_t> P_rows;     // bit-packed parity rows ('Q_LDPC' rows of 6 words)
 
 public:
 	Encoder_LDPC_DVBS2(const int K, const int N, const int n_frames = 1, const std::string name = "Encoder_LDPC_DVBS2");
+
+	/*!
+	 * \brief Builds the encoder from a table of addresses of parity bit accumulators (ETSI EN 302 307 annexes B and C
+	 *        layout): one line per group of 360 information bits, the addresses are separated by spaces.
+	 */
+	Encoder_LDPC_DVBS2(const int K, const int N, const std::string &table_path, const int n_frames = 1,
+	                   const std::string name = "Encoder_LDPC_DVBS2");
 	virtual ~Encoder_LDPC_DVBS2();
 
 protected:
@@ -27,6 +47,8 @@ protected:
 
 private:
 	void build_dvbs2();
+	void read_dvbs2(const std::string &table_path);
+	void init_dvbs2();
 };
 
 }
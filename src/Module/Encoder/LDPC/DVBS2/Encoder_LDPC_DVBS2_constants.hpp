@@ -6,6 +6,8 @@
 class dvbs2_values
 {
 public:
+	virtual ~dvbs2_values() {}
+
 	std::vector<int> EncValues;
 	int N_LDPC;
 	int K_LDPC;
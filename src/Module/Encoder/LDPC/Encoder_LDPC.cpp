@@ -4,7 +4,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/bash_tools.h"
-#include "Tools/Math/matrix.h"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Encoder_LDPC.hpp"
 
@@ -14,7 +14,7 @@ using namespace aff3ct::tools;
 template <typename B>
 Encoder_LDPC<B>
 ::Encoder_LDPC(const int K, const int N, const int n_frames, const std::string name)
-: Encoder<B>(K, N, n_frames, name), tG(N * K, 0)
+: Encoder<B>(K, N, n_frames, name), n_words_K(Bit_packer<B>::n_words(K)), U_K_packed(n_words_K, 0)
 {
 }
 
@@ -22,38 +22,57 @@ template <typename B>
 Encoder_LDPC<B>
 ::Encoder_LDPC(const int K, const int N, const Sparse_matrix &G, const int n_frames,
                const std::string name)
-: Encoder<B>(K, N, n_frames, name), tG(N * K, 0)
+: Encoder<B>(K, N, n_frames, name), n_words_K(Bit_packer<B>::n_words(K)), U_K_packed(n_words_K, 0)
 {
-	if (K != (int)G.get_n_cols())
+	this->init_G(G);
+}
+
+template <typename B>
+Encoder_LDPC<B>
+::Encoder_LDPC(const int K, const int N, std::shared_ptr<const LDPC_G_packed> G, const int n_frames,
+               const std::string name)
+: Encoder<B>(K, N, n_frames, name), n_words_K(Bit_packer<B>::n_words(K)), U_K_packed(n_words_K, 0)
+{
+	this->init_G(G);
+}
+
+template <typename B>
+Encoder_LDPC<B>
+::~Encoder_LDPC()
+{
+}
+
+template <typename B>
+void Encoder_LDPC<B>
+::init_G(const Sparse_matrix &G)
+{
+	this->init_G(std::make_shared<const LDPC_G_packed>(G));
+}
+
+template <typename B>
+void Encoder_LDPC<B>
+::init_G(std::shared_ptr<const LDPC_G_packed> G)
+{
+	if (G == nullptr)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'G' can't be null.");
+
+	if (this->K != (int)G->get_K())
 	{
 		std::stringstream message;
-		message << "The built G matrix has a dimension 'K' different than the given one ('K' = " << K
-		        << ", 'G.get_n_cols()' = " << G.get_n_cols() << ").";
+		message << "The built G matrix has a dimension 'K' different than the given one ('K' = " << this->K
+		        << ", 'G->get_K()' = " << G->get_K() << ").";
 		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)G.get_n_rows())
+	if (this->N != (int)G->get_N())
 	{
 		std::stringstream message;
-		message << "The built G matrix has a dimension 'N' different than the given one ('N' = " << N
-		        << ", 'G.get_n_rows()' = " << G.get_n_rows() << ").";
+		message << "The built G matrix has a dimension 'N' different than the given one ('N' = " << this->N
+		        << ", 'G->get_N()' = " << G->get_N() << ").";
 		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	auto CN_to_VN = G.get_col_to_rows();
-
-	mipp::vector<B> full_G(K * N,0);
-	for (auto i = 0; i < K; i++)
-		for (size_t j = 0; j < CN_to_VN[i].size(); ++j)
-			full_G[i * N + CN_to_VN[i][j]] = 1;
-
-	tools::real_transpose(K, N, full_G, tG); // transposed for computation matter
-}
-
-template <typename B>
-Encoder_LDPC<B>
-::~Encoder_LDPC()
-{
+	this->G_packed = G;
 }
 
 template <typename B>
@@ -75,11 +94,43 @@ template <typename B>
 void Encoder_LDPC<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	// Real General Matrix Multiplication
-	tools::rgemm(1, this->N, this->K, U_K, tG.data(), X_N);
+	const auto &sparse_rows   = this->G_packed->get_sparse_rows  ();
+	const auto &sparse_offset = this->G_packed->get_sparse_offset();
+	const auto &sparse_cols   = this->G_packed->get_sparse_cols  ();
+	const auto &dense_rows    = this->G_packed->get_dense_rows   ();
+	const auto &dense_words   = this->G_packed->get_dense_words  ();
+
+	for (size_t i = 0; i < sparse_rows.size(); i++)
+	{
+		B bit = 0;
+		for (auto j = sparse_offset[i]; j < sparse_offset[i +1]; j++)
+			bit ^= U_K[sparse_cols[j]];
+		X_N[sparse_rows[i]] = bit & (B)1;
+	}
+
+	if (!dense_rows.empty())
+	{
+		Bit_packer<B>::pack_words(U_K, U_K_packed.data(), this->K);
+
+		for (size_t i = 0; i < dense_rows.size(); i++)
+		{
+			const auto row = dense_words.data() + i * n_words_K;
+
+			uint64_t acc = 0;
+			for (auto w = 0; w < n_words_K; w++)
+				acc ^= row[w] & U_K_packed[w];
 
-	for (auto j = 0; j < this->N; ++j)
-		X_N[j] %= 2;
+			// parity of the accumulated word
+			acc ^= acc >> 32;
+			acc ^= acc >> 16;
+			acc ^= acc >>  8;
+			acc ^= acc >>  4;
+			acc ^= acc >>  2;
+			acc ^= acc >>  1;
+
+			X_N[dense_rows[i]] = (B)(acc & 1);
+		}
+	}
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -2,9 +2,12 @@
 #define ENCODER_LDPC_HPP_
 
 #include <vector>
+#include <memory>
+#include <cstdint>
 #include <mipp.h>
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/G_packed/LDPC_G_packed.hpp"
 
 #include "../Encoder.hpp"
 
@@ -17,7 +20,11 @@ template <typename B = int>
 class Encoder_LDPC : public Encoder<B>
 {
 protected:
-	mipp::vector<B> tG; // the generator matrix
+	// the codeword bits are computed with XORs on the packed generator matrix (no multiplication), the matrix is
+	// read-only and can be shared by the encoders of several threads
+	const int                                   n_words_K;  // number of 64-bit words in a bit-packed row of G
+	std::shared_ptr<const tools::LDPC_G_packed> G_packed;   // the generator matrix
+	std::vector<uint64_t>                       U_K_packed; // bit-packed information bits
 
 protected:
 	Encoder_LDPC(const int K, const int N, const int n_frames = 1, const std::string name = "Encoder_LDPC");
@@ -25,11 +32,27 @@ protected:
 public:
 	Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames = 1,
 	             const std::string name = "Encoder_LDPC");
+	Encoder_LDPC(const int K, const int N, std::shared_ptr<const tools::LDPC_G_packed> G, const int n_frames = 1,
+	             const std::string name = "Encoder_LDPC");
 	virtual ~Encoder_LDPC();
 
 	virtual void get_info_bits_pos(std::vector<unsigned>& info_bits_pos);
 
 protected:
+	/*!
+	 * \brief Stores the generator matrix in the encoder.
+	 *
+	 * \param G: the generator matrix, the rows are the codeword bits and the columns are the information bits.
+	 */
+	void init_G(const tools::Sparse_matrix &G);
+
+	/*!
+	 * \brief Shares an already packed generator matrix with the encoder (the matrix is not copied).
+	 *
+	 * \param G: the packed generator matrix.
+	 */
+	void init_G(std::shared_ptr<const tools::LDPC_G_packed> G);
+
 	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
 };
 
@@ -13,28 +13,54 @@
 using namespace aff3ct::module;
 using namespace aff3ct::tools;
 
+template <typename B>
+Encoder_LDPC_from_H<B>
+::Encoder_LDPC_from_H(const int K, const int N, const int n_frames, const std::string name)
+: Encoder_LDPC<B>(K, N, n_frames, name)
+{
+}
+
 template <typename B>
 Encoder_LDPC_from_H<B>
 ::Encoder_LDPC_from_H(const int K, const int N, const Sparse_matrix &H, const int n_frames,
                       const std::string name)
-: Encoder_LDPC<B>(K, N, n_frames, name), G(tools::LDPC_matrix_handler::transform_H_to_G(H, info_bits_pos))
+: Encoder_LDPC<B>(K, N, n_frames, name)
+{
+	this->init_G(tools::LDPC_matrix_handler::transform_H_to_G(H, info_bits_pos));
+}
+
+template <typename B>
+Encoder_LDPC_from_H<B>
+::Encoder_LDPC_from_H(const int K, const int N, const Sparse_matrix &G, const std::vector<unsigned> &info_bits_pos,
+                      const int n_frames, const std::string name)
+: Encoder_LDPC<B>(K, N, n_frames, name), info_bits_pos(info_bits_pos)
 {
-	// warning G is transposed !
-	if (K != (int)G.get_n_cols())
+	if (this->K != (int)info_bits_pos.size())
 	{
 		std::stringstream message;
-		message << "The built G matrix has a dimension 'K' different than the given one ('K' = " << K
-		        << ", 'G.get_n_cols()' = " << G.get_n_cols() << ").";
-		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		message << "'info_bits_pos.size()' has to be equal to 'K' ('info_bits_pos.size()' = " << info_bits_pos.size()
+		        << ", 'K' = " << this->K << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (N != (int)G.get_n_rows())
+	this->init_G(G);
+}
+
+template <typename B>
+Encoder_LDPC_from_H<B>
+::Encoder_LDPC_from_H(const int K, const int N, std::shared_ptr<const LDPC_G_packed> G,
+                      const std::vector<unsigned> &info_bits_pos, const int n_frames, const std::string name)
+: Encoder_LDPC<B>(K, N, n_frames, name), info_bits_pos(info_bits_pos)
+{
+	if (this->K != (int)info_bits_pos.size())
 	{
 		std::stringstream message;
-		message << "The built G matrix has a dimension 'N' different than the given one ('N' = " << N
-		        << ", 'G.get_n_rows()' = " << G.get_n_rows() << ").";
-		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		message << "'info_bits_pos.size()' has to be equal to 'K' ('info_bits_pos.size()' = " << info_bits_pos.size()
+		        << ", 'K' = " << this->K << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	this->init_G(G);
 }
 
 template <typename B>
@@ -58,19 +84,6 @@ void Encoder_LDPC_from_H<B>
 	std::copy(this->info_bits_pos.begin(), this->info_bits_pos.end(), info_bits_pos.begin());
 }
 
-template <typename B>
-void Encoder_LDPC_from_H<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
-{
-	for (unsigned i = 0; i < G.get_n_rows(); i++)
-	{
-		X_N[i] = 0;
-		for (unsigned j = 0; j < G.get_cols_from_row(i).size(); j++)
-			X_N[i] += U_K[ G.get_cols_from_row(i)[j] ];
-		X_N[i] %= 2;
-	}
-}
-
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -2,6 +2,7 @@
 #define ENCODER_LDPC_FROM_H_HPP_
 
 #include <vector>
+#include <memory>
 #include <mipp.h>
 
 #include "../Encoder_LDPC.hpp"
@@ -19,17 +20,23 @@ class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
 protected:
 	std::vector<unsigned> info_bits_pos;
-	tools::Sparse_matrix G; // position of ones by column
+
+protected:
+	Encoder_LDPC_from_H(const int K, const int N, const int n_frames = 1, const std::string name = "Encoder_LDPC_from_H");
 
 public:
 	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1,
 	                    const std::string name = "Encoder_LDPC_from_H");
+	// G and 'info_bits_pos' have already been derived from H (see tools::LDPC_matrix_handler::transform_H_to_G)
+	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &G,
+	                    const std::vector<unsigned> &info_bits_pos, const int n_frames = 1,
+	                    const std::string name = "Encoder_LDPC_from_H");
+	Encoder_LDPC_from_H(const int K, const int N, std::shared_ptr<const tools::LDPC_G_packed> G,
+	                    const std::vector<unsigned> &info_bits_pos, const int n_frames = 1,
+	                    const std::string name = "Encoder_LDPC_from_H");
 	virtual ~Encoder_LDPC_from_H();
 
 	virtual void get_info_bits_pos(std::vector<unsigned>& info_bits_pos);
-
-protected:
-	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
 };
 
 }
@@ -0,0 +1,152 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+
+#include "Encoder_LDPC_RU.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+template <typename B>
+Encoder_LDPC_RU<B>
+::Encoder_LDPC_RU(const int K, const int N, const Sparse_matrix &H, const int n_frames, const std::string name)
+: Encoder_LDPC_from_H<B>(K, N, n_frames, name), ru(H, K)
+{
+	if (ru.is_valid())
+		this->check_form();
+	else
+		this->init_G(LDPC_matrix_handler::transform_H_to_G(H, this->info_bits_pos));
+}
+
+template <typename B>
+Encoder_LDPC_RU<B>
+::Encoder_LDPC_RU(const int K, const int N, const LDPC_RU_form &ru, std::shared_ptr<const LDPC_G_packed> G,
+                  const std::vector<unsigned> &info_bits_pos, const int n_frames, const std::string name)
+: Encoder_LDPC_from_H<B>(K, N, n_frames, name), ru(ru)
+{
+	if (ru.is_valid())
+		this->check_form();
+	else
+	{
+		if (this->K != (int)info_bits_pos.size())
+		{
+			std::stringstream message;
+			message << "'info_bits_pos.size()' has to be equal to 'K' ('info_bits_pos.size()' = "
+			        << info_bits_pos.size() << ", 'K' = " << this->K << ").";
+			throw length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->info_bits_pos = info_bits_pos;
+		this->init_G(G);
+	}
+}
+
+template <typename B>
+Encoder_LDPC_RU<B>
+::~Encoder_LDPC_RU()
+{
+}
+
+template <typename B>
+void Encoder_LDPC_RU<B>
+::check_form()
+{
+	if (this->K != (int)ru.get_K() || this->N != (int)ru.get_N())
+	{
+		std::stringstream message;
+		message << "The form has dimensions different than the given ones ('K' = " << this->K << ", 'N' = "
+		        << this->N << ", 'ru.get_K()' = " << ru.get_K() << ", 'ru.get_N()' = " << ru.get_N() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->info_bits_pos = ru.get_info_bits_pos();
+	z.resize(ru.get_n_P_words());
+}
+
+template <typename B>
+void Encoder_LDPC_RU<B>
+::back_substitute(B *X_N)
+{
+	const auto &tri_bits   = ru.get_tri_bits  ();
+	const auto &tri_offset = ru.get_tri_offset();
+	const auto &tri_vars   = ru.get_tri_vars  ();
+
+	for (size_t t = 0; t < tri_bits.size(); t++)
+	{
+		B bit = 0;
+		for (auto i = tri_offset[t]; i < tri_offset[t +1]; i++)
+			bit ^= X_N[tri_vars[i]];
+		X_N[tri_bits[t]] = bit;
+	}
+}
+
+template <typename B>
+void Encoder_LDPC_RU<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	if (!ru.is_valid())
+	{
+		Encoder_LDPC<B>::_encode(U_K, X_N, frame_id);
+		return;
+	}
+
+	const auto &gap_bits = ru.get_gap_bits();
+
+	for (auto i = 0; i < this->K; i++)
+		X_N[this->info_bits_pos[i]] = U_K[i] & (B)1;
+	for (auto g : gap_bits)
+		X_N[g] = 0;
+
+	this->back_substitute(X_N);
+
+	if (!gap_bits.empty())
+	{
+		const auto &left_offset = ru.get_left_offset();
+		const auto &left_vars   = ru.get_left_vars  ();
+		const auto &P           = ru.get_P          ();
+		const auto  n_P_words   = ru.get_n_P_words  ();
+
+		std::fill(z.begin(), z.end(), (uint64_t)0);
+		for (unsigned r = 0; r < ru.get_n_left_checks(); r++)
+		{
+			B bit = 0;
+			for (auto i = left_offset[r]; i < left_offset[r +1]; i++)
+				bit ^= X_N[left_vars[i]];
+			z[r >> 6] |= (uint64_t)bit << (r & 63);
+		}
+
+		for (size_t k = 0; k < gap_bits.size(); k++)
+		{
+			uint64_t acc = 0;
+			for (unsigned w = 0; w < n_P_words; w++)
+				acc ^= P[k * n_P_words + w] & z[w];
+
+			// parity of the accumulated word
+			acc ^= acc >> 32;
+			acc ^= acc >> 16;
+			acc ^= acc >>  8;
+			acc ^= acc >>  4;
+			acc ^= acc >>  2;
+			acc ^= acc >>  1;
+
+			X_N[gap_bits[k]] = (B)(acc & 1);
+		}
+
+		// the triangular bits depend on the gap bits
+		this->back_substitute(X_N);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Encoder_LDPC_RU<B_8>;
+template class aff3ct::module::Encoder_LDPC_RU<B_16>;
+template class aff3ct::module::Encoder_LDPC_RU<B_32>;
+template class aff3ct::module::Encoder_LDPC_RU<B_64>;
+#else
+template class aff3ct::module::Encoder_LDPC_RU<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,55 @@
+#ifndef ENCODER_LDPC_RU_HPP_
+#define ENCODER_LDPC_RU_HPP_
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "../From_H/Encoder_LDPC_from_H.hpp"
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/RU/LDPC_RU_form.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Encoder_LDPC_RU
+ *
+ * \brief Encodes directly from the parity-check matrix H (Richardson-Urbanke), in a time close to linear.
+ *
+ * \tparam B: type of the bits in the Encoder.
+ *
+ * The parity bits are computed by sparse back-substitution on an approximate lower triangular form of H (see
+ * tools::LDPC_RU_form). When H has no such form, the encoder falls back on a generator matrix (like
+ * Encoder_LDPC_from_H).
+ */
+template <typename B = int>
+class Encoder_LDPC_RU : public Encoder_LDPC_from_H<B>
+{
+protected:
+	const tools::LDPC_RU_form ru;
+	std::vector<uint64_t>     z;  // bit-packed syndrome of the left check nodes (computed with the gap bits to 0)
+
+public:
+	Encoder_LDPC_RU(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1,
+	                const std::string name = "Encoder_LDPC_RU");
+	// the form has already been computed from H, G and 'info_bits_pos' are used when the form is not valid
+	Encoder_LDPC_RU(const int K, const int N, const tools::LDPC_RU_form &ru,
+	                std::shared_ptr<const tools::LDPC_G_packed> G, const std::vector<unsigned> &info_bits_pos,
+	                const int n_frames = 1, const std::string name = "Encoder_LDPC_RU");
+	virtual ~Encoder_LDPC_RU();
+
+protected:
+	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
+
+private:
+	void check_form();
+	void back_substitute(B *X_N);
+};
+
+}
+}
+
+#endif /* ENCODER_LDPC_RU_HPP_ */
@@ -1,18 +1,25 @@
 #include <vector>
 #include <cmath>
 #include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Encoder_polar.hpp"
 
 using namespace aff3ct::module;
 
+// the bits 'i' with (i & k) == 0, for k = 1, 2, 4, 8, 16, 32
+static const uint64_t low_half_masks[6] = {0x5555555555555555ULL, 0x3333333333333333ULL, 0x0F0F0F0F0F0F0F0FULL,
+                                           0x00FF00FF00FF00FFULL, 0x0000FFFF0000FFFFULL, 0x00000000FFFFFFFFULL};
+
 template <typename B>
 Encoder_polar<B>
 ::Encoder_polar(const int& K, const int& N, const mipp::vector<B>& frozen_bits, const int n_frames, 
                 const std::string name)
-: Encoder<B>(K, N, n_frames, name), m((int)std::log2(N)), frozen_bits(frozen_bits)
+: Encoder<B>(K, N, n_frames, name), m((int)std::log2(N)), frozen_bits(frozen_bits),
+  n_words_N(tools::Bit_packer<B>::n_words(N)), X_N_packed(n_words_N * n_frames)
 {
 	if (this->N != (int)frozen_bits.size())
 	{
@@ -32,22 +39,117 @@ Encoder_polar<B>
 	}
 }
 
+template <typename B>
+void Encoder_polar<B>
+::encode(const B *U_K, B *X_N)
+{
+	if (this->n_frames == 1)
+	{
+		Encoder<B>::encode(U_K, X_N);
+		return;
+	}
+
+	this->pack(U_K, this->n_frames);
+	this->_encode_packed(this->n_frames);
+	this->unpack(X_N, this->n_frames);
+}
+
 template <typename B>
 void Encoder_polar<B>
 ::_encode(const B *U_K, B *X_N, const int frame_id)
 {
-	this->convert(U_K, X_N);
-	this->light_encode(X_N);
+	this->pack(U_K, 1);
+	this->_encode_packed(1);
+	this->unpack(X_N, 1);
+}
+
+template <typename B>
+void Encoder_polar<B>
+::_encode_packed(const int n_lanes)
+{
+	transform(X_N_packed.data(), this->N, n_lanes);
 }
 
 template <typename B>
 void Encoder_polar<B>
 ::light_encode(B *bits)
 {
-	for (auto k = (this->N >> 1); k > 0; k >>= 1)
-		for (auto j = 0; j < this->N; j += 2 * k)
-			for (auto i = 0; i < k; i++)
-				bits[j + i] = bits[j + i] ^ bits[k + j + i];
+	tools::Bit_packer<B>::pack_words(bits, X_N_packed.data(), this->N);
+	transform(X_N_packed.data(), this->N, 1);
+	tools::Bit_packer<B>::unpack_words(X_N_packed.data(), bits, this->N);
+}
+
+template <typename B>
+void Encoder_polar<B>
+::transform(uint64_t *words, const int N, const int n_lanes)
+{
+	const auto n_words = tools::Bit_packer<B>::n_words(N);
+
+	// stages of distance k < 64: bits[i] ^= bits[i + k] for the bits 'i' with (i & k) == 0, inside each word (the
+	// stages commute, they are all applied to a word at once)
+	const auto n_in_word_stages = std::min(6, (int)std::log2(N));
+	for (auto w = 0; w < n_words * n_lanes; w++)
+	{
+		auto x = words[w];
+		for (auto s = 0; s < n_in_word_stages; s++)
+			x ^= (x >> (1 << s)) & low_half_masks[s];
+		words[w] = x;
+	}
+
+	// stages of distance k >= 64: whole words
+	for (auto kw = n_words >> 1; kw > 0; kw >>= 1)
+		for (auto j = 0; j < n_words; j += 2 * kw)
+		{
+			const auto lo = words + (j     ) * n_lanes;
+			const auto hi = words + (j + kw) * n_lanes;
+			for (auto i = 0; i < kw * n_lanes; i++)
+				lo[i] ^= hi[i];
+		}
+}
+
+template <typename B>
+void Encoder_polar<B>
+::pack(const B *U_K, const int n_lanes)
+{
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		const auto U = U_K + f * this->K;
+
+		// branchless: the frozen bits are irregular and would be mispredicted
+		auto j = 0;
+		for (auto w = 0; w < n_words_N; w++)
+		{
+			const auto n_bits = std::min(64, this->N - w * 64);
+
+			uint64_t word = 0;
+			for (auto b = 0; b < n_bits; b++)
+			{
+				const auto is_info = (uint64_t)(frozen_bits[w * 64 + b] == 0);
+				word |= (is_info & (uint64_t)(U[j < this->K ? j : 0] != 0)) << b;
+				j += (int)is_info;
+			}
+			X_N_packed[w * n_lanes + f] = word;
+		}
+	}
+}
+
+template <typename B>
+void Encoder_polar<B>
+::unpack(B *X_N, const int n_lanes) const
+{
+	for (auto f = 0; f < n_lanes; f++)
+	{
+		const auto X = X_N + f * this->N;
+
+		for (auto w = 0; w < n_words_N; w++)
+		{
+			const auto n_bits = std::min(64, this->N - w * 64);
+			const auto word   = X_N_packed[w * n_lanes + f];
+
+			for (auto b = 0; b < n_bits; b++)
+				X[w * 64 + b] = (B)((word >> b) & 1);
+		}
+	}
 }
 
 template <typename B>
@@ -2,6 +2,7 @@
 #define ENCODER_POLAR_HPP_
 
 #include <vector>
+#include <cstdint>
 #include <mipp.h>
 
 #include "../Encoder.hpp"
@@ -10,23 +11,52 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Encoder_polar
+ *
+ * \brief Encodes with the polar transform on bit-packed frames (64 bits per word).
+ *
+ * \tparam B: type of the bits in the Encoder.
+ *
+ * The stages of the transform acting inside a word (distance < 64) are shifts with constant masks, the other stages
+ * are whole word XORs. When the encoder processes several frames (n_frames > 1), the words of the frames are
+ * interleaved (word 'w' of the frame 'f' at 'w * n_frames + f'): each stage is a single loop over the words of all the
+ * frames (inter-frame SIMD).
+ */
 template <typename B = int>
 class Encoder_polar : public Encoder<B>
 {
 protected:
 	const int              m;           // log_2 of code length
 	const mipp::vector<B>& frozen_bits; // true means frozen, false means set to 0/1
+	const int              n_words_N;   // number of 64-bit words in a bit-packed frame
+	std::vector<uint64_t>  X_N_packed;  // bit-packed frames (interleaved when several frames are encoded at once)
 
 public:
-	Encoder_polar(const int& K, const int& N, const mipp::vector<B>& frozen_bits, const int n_frames = 1, 
+	Encoder_polar(const int& K, const int& N, const mipp::vector<B>& frozen_bits, const int n_frames = 1,
 	              const std::string name = "Encoder_polar");
 	virtual ~Encoder_polar() {}
 
+	virtual void encode(const B *U_K, B *X_N); using Encoder<B>::encode;
+
 	void light_encode(B *bits);
 
 protected:
 	virtual void _encode(const B *U_K, B *X_N, const int frame_id);
 	void convert(const B *U_K, B *U_N);
+
+	/*!
+	 * \brief Encodes the 'n_lanes' bit-packed frames of 'X_N_packed' (interleaved words).
+	 */
+	virtual void _encode_packed(const int n_lanes);
+
+	/*!
+	 * \brief Applies the polar transform on 'n_lanes' bit-packed frames of 'N' bits (interleaved words).
+	 */
+	static void transform(uint64_t *words, const int N, const int n_lanes);
+
+	void pack  (const B *U_K, const int n_lanes);
+	void unpack(      B *X_N, const int n_lanes) const;
 };
 }
 }
@@ -1,6 +1,7 @@
 #include <vector>
 #include <cmath>
 #include <iostream>
+#include <algorithm>
 
 #include "Encoder_polar_sys.hpp"
 
@@ -10,24 +11,28 @@ template <typename B>
 Encoder_polar_sys<B>
 ::Encoder_polar_sys(const int& K, const int& N, const mipp::vector<B>& frozen_bits, const int& n_frames,
                     const std::string name)
-: Encoder_polar<B>(K, N, frozen_bits, n_frames, name)
+: Encoder_polar<B>(K, N, frozen_bits, n_frames, name), info_mask(this->n_words_N)
 {
 }
 
 template <typename B>
 void Encoder_polar_sys<B>
-::_encode(const B *U_K, B *X_N, const int frame_id)
+::_encode_packed(const int n_lanes)
 {
-	this->convert(U_K, X_N);
+	// the frozen bits can be updated between two calls
+	std::fill(info_mask.begin(), info_mask.end(), (uint64_t)0);
+	for (auto i = 0; i < this->N; i++)
+		info_mask[i >> 6] |= (uint64_t)(!this->frozen_bits[i]) << (i & 63);
 
 	// first time encode
-	this->light_encode(X_N);
+	this->transform(this->X_N_packed.data(), this->N, n_lanes);
 
-	for (auto i = 0; i < this->N; i++)
-		X_N[i] = !this->frozen_bits[i] && X_N[i];
+	for (auto w = 0; w < this->n_words_N; w++)
+		for (auto f = 0; f < n_lanes; f++)
+			this->X_N_packed[w * n_lanes + f] &= info_mask[w];
 
 	// second time encode because of systematic encoder
-	this->light_encode(X_N);
+	this->transform(this->X_N_packed.data(), this->N, n_lanes);
 }
 
 // ==================================================================================== explicit template instantiation 
@@ -2,6 +2,7 @@
 #define ENCODER_POLAR_SYS_HPP_
 
 #include <vector>
+#include <cstdint>
 #include <mipp.h>
 
 #include "Encoder_polar.hpp"
@@ -13,13 +14,16 @@ namespace module
 template <typename B = int>
 class Encoder_polar_sys : public Encoder_polar<B>
 {
+protected:
+	std::vector<uint64_t> info_mask; // bit-packed information bits positions (the complement of the frozen bits)
+
 public:
 	Encoder_polar_sys(const int& K, const int& N, const mipp::vector<B>& frozen_bits, const int& n_frames = 1,
 	                  const std::string name = "Encoder_polar_sys");
 	virtual ~Encoder_polar_sys() {}
 
 protected:
-	void _encode(const B *U_K, B *X_N, const int frame_id);
+	void _encode_packed(const int n_lanes);
 };
 }
 }
@@ -0,0 +1,271 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Encoder_RSC_table_sys.hpp"
+
+using namespace aff3ct::module;
+using namespace aff3ct::tools;
+
+static int trellis_n_ff(const std::vector<std::vector<int>> &trellis)
+{
+	if (trellis.size() != 10)
+	{
+		std::stringstream message;
+		message << "'trellis.size()' has to be equal to 10 ('trellis.size()' = " << trellis.size() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_states = (int)trellis[6].size();
+	if (n_states < 2 || (n_states & (n_states -1)))
+	{
+		std::stringstream message;
+		message << "The number of states has to be a power of 2 greater than 1 ('n_states' = " << n_states << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto i = 7; i < 10; i++)
+		if ((int)trellis[i].size() != n_states)
+		{
+			std::stringstream message;
+			message << "'trellis[" << i << "].size()' has to be equal to 'n_states' ('trellis[" << i << "].size()' = "
+			        << trellis[i].size() << ", 'n_states' = " << n_states << ").";
+			throw length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	return (int)std::round(std::log2(n_states));
+}
+
+template <typename B>
+Encoder_RSC_table_sys<B>
+::Encoder_RSC_table_sys(const int& K, const int& N, const std::vector<std::vector<int>> &trellis,
+                        const bool buffered_encoding, const int n_frames, const std::string name)
+: Encoder_RSC_sys<B>(K, N, trellis_n_ff(trellis), n_frames, buffered_encoding, name),
+  out_parity(2 * this->n_states),
+  next_state(2 * this->n_states),
+  sys_tail  (    this->n_states),
+  table     (256 * this->n_states),
+  states    (n_frames)
+{
+	// the trellis stores the final states and the gammas (systematic bit ^ parity bit) for a systematic bit 0 and 1
+	for (auto s = 0; s < this->n_states; s++)
+	{
+		next_state[2 * s +0] = trellis[6][s];
+		next_state[2 * s +1] = trellis[8][s];
+		out_parity[2 * s +0] = trellis[7][s];
+		out_parity[2 * s +1] = trellis[9][s] ^ 1;
+
+		for (auto b = 0; b < 2; b++)
+			if (next_state[2 * s +b] < 0 || next_state[2 * s +b] >= this->n_states ||
+			    out_parity[2 * s +b] < 0 || out_parity[2 * s +b] > 1)
+			{
+				std::stringstream message;
+				message << "The trellis contains invalid transitions ('state' = " << s << ", 'bit_sys' = " << b
+				        << ", 'next_state' = " << next_state[2 * s +b] << ", 'bit_par' = " << out_parity[2 * s +b]
+				        << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+		// the tail bit shifts a 0 in the most significant flip-flop
+		const auto msb0 = next_state[2 * s +0] < this->n_states / 2;
+		const auto msb1 = next_state[2 * s +1] < this->n_states / 2;
+		if (msb0 == msb1)
+		{
+			std::stringstream message;
+			message << "One and only one systematic bit has to clear the most significant flip-flop ('state' = " << s
+			        << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+		sys_tail[s] = msb0 ? 0 : 1;
+	}
+
+	for (auto s = 0; s < this->n_states; s++)
+	{
+		auto state = s;
+		for (auto i = 0; i < this->n_ff; i++)
+			state = next_state[2 * state + sys_tail[state]];
+
+		if (state != 0)
+		{
+			std::stringstream message;
+			message << "The trellis can't be terminated in 'n_ff' steps ('initial state' = " << s << ", 'n_ff' = "
+			        << this->n_ff << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	for (auto s = 0; s < this->n_states; s++)
+		for (auto c = 0; c < 256; c++)
+		{
+			auto state = s;
+			uint32_t par = 0;
+			for (auto j = 0; j < 8; j++)
+			{
+				const auto bit_sys = (c >> j) & 1;
+				par  |= (uint32_t)out_parity[2 * state + bit_sys] << j;
+				state = next_state[2 * state + bit_sys];
+			}
+			table[s * 256 + c] = par | ((uint32_t)state << 8);
+		}
+}
+
+template <typename B>
+int Encoder_RSC_table_sys<B>
+::inner_encode(const int bit_sys, int &state)
+{
+	auto symbol = this->out_parity[2 * state + bit_sys];
+	     state  = this->next_state[2 * state + bit_sys];
+	return symbol;
+}
+
+template <typename B>
+int Encoder_RSC_table_sys<B>
+::tail_bit_sys(const int &state)
+{
+	return this->sys_tail[state];
+}
+
+template <typename B>
+void Encoder_RSC_table_sys<B>
+::encode(const B *U_K, B *X_N)
+{
+	if (this->buffered_encoding)
+	{
+		for (auto f = 0; f < this->n_frames; f++)
+			std::copy(U_K + f * this->K, U_K + (f +1) * this->K, X_N + f * this->N); // sys
+		this->encode_frames(U_K, X_N + this->K, this->n_frames, this->N, true); // par + tail bits
+	}
+	else
+		this->encode_frames(U_K, X_N, this->n_frames, this->N, false);
+}
+
+template <typename B>
+void Encoder_RSC_table_sys<B>
+::encode_sys(const B *U_K, B *par)
+{
+	this->encode_frames(U_K, par, this->n_frames, this->N - this->K, true);
+}
+
+template <typename B>
+void Encoder_RSC_table_sys<B>
+::_encode(const B *U_K, B *X_N, const int frame_id)
+{
+	if (this->buffered_encoding)
+	{
+		std::copy(U_K, U_K + this->K, X_N); // sys
+		this->encode_frames(U_K, X_N + this->K, 1, this->N, true); // par + tail bits
+	}
+	else
+		this->encode_frames(U_K, X_N, 1, this->N, false);
+}
+
+template <typename B>
+void Encoder_RSC_table_sys<B>
+::_encode_sys(const B *U_K, B *par, const int frame_id)
+{
+	this->encode_frames(U_K, par, 1, this->N - this->K, true);
+}
+
+template <typename B>
+void Encoder_RSC_table_sys<B>
+::encode_frames(const B *U_K, B *X_N, const int n_frames, const int X_size, const bool only_parity)
+{
+	const auto K      = this->K;
+	const auto n_ff   = this->n_ff;
+	const auto stride = only_parity ? 1 : 2;
+
+	// 8 trellis steps per lookup, the frames are interleaved by groups of 'n_lanes' to hide the latency of the lookups
+	// (the states are kept in a local array: the compiler knows that the output bits can't overwrite them)
+	constexpr int n_lanes = 8;
+	const uint32_t* tab = table.data();
+	const auto K8 = (K / 8) * 8;
+	for (auto f0 = 0; f0 < n_frames; f0 += n_lanes)
+	{
+		const auto n_cur = std::min(n_lanes, n_frames - f0);
+
+		uint32_t st[n_lanes];
+		std::fill(st, st + n_lanes, (uint32_t)0); // initial (and final) state 0 0 0
+
+		for (auto i = 0; i < K8; i += 8)
+			for (auto l = 0; l < n_cur; l++)
+			{
+				const B* u = U_K + (f0 + l) * K + i;
+				      B* x = X_N + (f0 + l) * X_size + i * stride;
+
+				uint32_t chunk = 0;
+				for (auto j = 0; j < 8; j++)
+					chunk |= (uint32_t)(u[j] & 1) << j;
+
+				const auto entry = tab[(st[l] << 8) | chunk];
+				st[l] = entry >> 8;
+
+				if (only_parity)
+					for (auto j = 0; j < 8; j++)
+						x[j] = (B)((entry >> j) & 1);
+				else
+					for (auto j = 0; j < 8; j++)
+					{
+						x[2 * j +0] = u[j];
+						x[2 * j +1] = (B)((entry >> j) & 1);
+					}
+			}
+
+		for (auto l = 0; l < n_cur; l++)
+			states[f0 + l] = (int)st[l];
+	}
+
+	for (auto f = 0; f < n_frames; f++)
+	{
+		const B* u = U_K + f * K;
+		      B* x = X_N + f * X_size;
+
+		auto state = states[f];
+		auto j = K8 * stride;
+		for (auto i = K8; i < K; i++)
+		{
+			if (!only_parity)
+			{
+				x[j] = u[i];
+				j++; // systematic transmission of the bit
+			}
+			x[j] = (B)inner_encode((int)(u[i] & 1), state); j++; // encoding block
+		}
+
+		// tail bits for initialization conditions (state of data "state" have to be 0 0 0)
+		for (auto i = 0; i < n_ff; i++)
+		{
+			B bit_sys = (B)tail_bit_sys(state);
+
+			if (!only_parity)
+			{
+				x[j] = bit_sys; // systematic transmission of the bit
+				j++;
+			}
+			else
+				x[j + n_ff] = bit_sys; // systematic transmission of the bit
+
+			x[j] = (B)inner_encode((int)bit_sys, state); j++; // encoding block
+		}
+
+		if (state != 0)
+		{
+			std::stringstream message;
+			message << "'state' should be equal to 0 ('state' = " <<  state << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template class aff3ct::module::Encoder_RSC_table_sys<B_8>;
+template class aff3ct::module::Encoder_RSC_table_sys<B_16>;
+template class aff3ct::module::Encoder_RSC_table_sys<B_32>;
+template class aff3ct::module::Encoder_RSC_table_sys<B_64>;
+#else
+template class aff3ct::module::Encoder_RSC_table_sys<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,58 @@
+#ifndef ENCODER_RSC_TABLE_SYS_HPP_
+#define ENCODER_RSC_TABLE_SYS_HPP_
+
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Encoder_RSC_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Encoder_RSC_table_sys
+ *
+ * \brief Encodes with a RSC code described by its trellis, 8 trellis steps at a time.
+ *
+ * \tparam B: type of the bits in the Encoder.
+ *
+ * The trellis has the layout of Encoder_RSC_sys::get_trellis() (the trellis of Encoder_RSC_generic_sys or the one
+ * traced by Encoder_RSC_generic_json_sys). For each state and each chunk of 8 information bits, a table gives the
+ * next state and the 8 parity bits. When several frames are encoded, the frames are processed side by side: the
+ * lookups of the different frames are independent and overlap in the pipeline.
+ */
+template <typename B = int>
+class Encoder_RSC_table_sys : public Encoder_RSC_sys<B>
+{
+private:
+	std::vector<int>      out_parity; // parity bit of each state for a systematic bit 0 and 1
+	std::vector<int>      next_state; // next state of each state for a systematic bit 0 and 1
+	std::vector<int>      sys_tail;   // systematic bit which shifts a 0 in the flip-flops
+	std::vector<uint32_t> table;      // for each state and 8-bit chunk: 8 parity bits | next state << 8
+	std::vector<int>      states;     // current state of each frame
+
+public:
+	Encoder_RSC_table_sys(const int& K, const int& N, const std::vector<std::vector<int>> &trellis,
+	                      const bool buffered_encoding = true, const int n_frames = 1,
+	                      const std::string name = "Encoder_RSC_table_sys");
+	virtual ~Encoder_RSC_table_sys() {}
+
+	virtual void encode    (const B *U_K, B *X_N); using Encoder_RSC_sys<B>::encode;
+	virtual void encode_sys(const B *U_K, B *par); using Encoder_RSC_sys<B>::encode_sys;
+
+protected:
+	void _encode    (const B *U_K, B *X_N, const int frame_id);
+	void _encode_sys(const B *U_K, B *par, const int frame_id);
+
+	virtual int inner_encode(const int bit_sys, int &state);
+	virtual int tail_bit_sys(const int &state             );
+
+private:
+	void encode_frames(const B *U_K, B *X_N, const int n_frames, const int X_size, const bool only_parity);
+};
+}
+}
+
+#endif // ENCODER_RSC_TABLE_SYS_HPP_
@@ -22,6 +22,13 @@ void Source_AZCW<B>
 	std::fill(U_K, U_K + this->K * this->n_frames, 0);
 }
 
+template <typename B>
+void Source_AZCW<B>
+::generate_packed(uint64_t *U_K)
+{
+	std::fill(U_K, U_K + tools::Bit_packer<B>::n_words(this->K) * this->n_frames, (uint64_t)0);
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
@@ -19,7 +19,8 @@ public:
 
 	virtual ~Source_AZCW();
 
-	void generate(B *U_K);  using Source<B>::generate;
+	void generate       (B        *U_K); using Source<B>::generate;
+	void generate_packed(uint64_t *U_K); using Source<B>::generate_packed;
 };
 }
 }
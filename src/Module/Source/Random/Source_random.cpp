@@ -28,6 +28,28 @@ void Source_random<B>
 		U_K[i] = (B)this->uniform_dist(this->rd_engine);
 }
 
+template <typename B>
+void Source_random<B>
+::generate_packed(uint64_t *U_K)
+{
+	const auto n_words = tools::Bit_packer<B>::n_words(this->K);
+	const auto n_bits_last_word = this->K % 64;
+
+	// one 32-bit draw of the Mersenne Twister gives 32 random bits
+	for (auto f = 0; f < this->n_frames; f++)
+	{
+		for (auto w = 0; w < n_words; w++)
+		{
+			const auto lo = (uint64_t)this->rd_engine();
+			const auto hi = (uint64_t)this->rd_engine();
+			U_K[f * n_words +w] = (hi << 32) | lo;
+		}
+
+		if (n_bits_last_word)
+			U_K[(f +1) * n_words -1] &= ((uint64_t)1 << n_bits_last_word) -1;
+	}
+}
+
 // ==================================================================================== explicit template instantiation 
 #include "Tools/types.h"
 #ifdef MULTI_PREC
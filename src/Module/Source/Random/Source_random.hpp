@@ -28,8 +28,8 @@ public:
 
 	virtual ~Source_random();
 
-	void generate(B *U_K); using Source<B>::generate;
-	
+	void generate       (B        *U_K); using Source<B>::generate;
+	void generate_packed(uint64_t *U_K); using Source<B>::generate_packed;
 };
 }
 }
@@ -24,7 +24,8 @@ public:
 	Source_random_fast(const int K, const int seed = 0, const int n_frames = 1, const std::string name = "Source_random_fast");
 	virtual ~Source_random_fast();
 
-	void generate(B *U_K); using Source<B>::generate;
+	void generate       (B        *U_K); using Source<B>::generate;
+	void generate_packed(uint64_t *U_K); using Source<B>::generate_packed;
 };
 }
 }
@@ -10,10 +10,12 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <sstream>
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Bit_packer.hpp"
 
 #include "Module/Module.hpp"
 
@@ -91,6 +93,32 @@ public:
 			this->_generate(U_K + f * this->K, f);
 	}
 
+	/*!
+	 * \brief Fulfills a vector with bits packed in 64-bit words (see tools::Bit_packer::pack_words for the layout).
+	 *
+	 * Skips the one bit per element representation when the next stage accepts packed bits.
+	 *
+	 * \param U_K: a vector of packed bits to fill ('tools::Bit_packer<B>::n_words(K)' words per frame).
+	 */
+	void generate_packed(std::vector<uint64_t>& U_K)
+	{
+		if (tools::Bit_packer<B>::n_words(this->K) * this->n_frames != (int)U_K.size())
+		{
+			std::stringstream message;
+			message << "'U_K.size()' has to be equal to 'n_words(K)' * 'n_frames' ('U_K.size()' = " << U_K.size()
+			        << ", 'n_words(K)' = " << tools::Bit_packer<B>::n_words(this->K)
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->generate_packed(U_K.data());
+	}
+
+	virtual void generate_packed(uint64_t *U_K)
+	{
+		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
+	}
+
 protected:
 	virtual void _generate(B *U_K, const int frame_id)
 	{
@@ -200,7 +200,10 @@ Channel<R>* Simulation_BFER_std<B,R,Q>
 	                                 this->params.channel.path,
 	                                 seed,
 	                                 this->sigma,
-	                                 this->params.simulation.inter_frame_level);
+	                                 this->params.simulation.inter_frame_level,
+	                                 this->params.channel.doppler,
+	                                 this->params.channel.n_sin,
+	                                 this->params.channel.probability);
 }
 
 template <typename B, typename R, typename Q>
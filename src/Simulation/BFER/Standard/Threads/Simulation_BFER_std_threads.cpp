@@ -1,10 +1,14 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <sstream>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Display/Frame_trace/Frame_trace.hpp"
 #include "Tools/Display/bash_tools.h"
+#include "Tools/Algo/Bit_packer.hpp"
+#include "Module/Channel/Binary/Channel_binary.hpp"
 
 #include "Simulation_BFER_std_threads.hpp"
 
@@ -17,6 +21,8 @@ Simulation_BFER_std_threads<B,R,Q>
 ::Simulation_BFER_std_threads(const parameters& params, Codec<B,Q> &codec)
 : Simulation_BFER_std<B,R,Q>(params, codec),
 
+  packed(Simulation_BFER_std_threads<B,R,Q>::is_packed_chain(params)),
+
   U_K1(this->params.simulation.n_threads, mipp::vector<B>(params.code.K_info * params.simulation.inter_frame_level)),
   U_K2(this->params.simulation.n_threads, mipp::vector<B>(params.code.K      * params.simulation.inter_frame_level)),
   X_N1(this->params.simulation.n_threads, mipp::vector<B>(params.code.N_code * params.simulation.inter_frame_level)),
@@ -29,13 +35,34 @@ Simulation_BFER_std_threads<B,R,Q>
   Y_N4(this->params.simulation.n_threads, mipp::vector<Q>(params.code.N      * params.simulation.inter_frame_level)),
   Y_N5(this->params.simulation.n_threads, mipp::vector<Q>(params.code.N_code * params.simulation.inter_frame_level)),
   V_K1(this->params.simulation.n_threads, mipp::vector<B>(params.code.K      * params.simulation.inter_frame_level)),
-  V_K2(this->params.simulation.n_threads, mipp::vector<B>(params.code.K_info * params.simulation.inter_frame_level))
+  V_K2(this->params.simulation.n_threads, mipp::vector<B>(params.code.K_info * params.simulation.inter_frame_level)),
+
+  U_K_pck(this->params.simulation.n_threads, std::vector<uint64_t>(is_packed_source(params) ?
+                                                                   Bit_packer<B>::n_words(params.code.K_info) *
+                                                                   params.simulation.inter_frame_level : 0)),
+  X_N_pck(this->params.simulation.n_threads, std::vector<uint64_t>(packed ? Bit_packer<B>::n_words(params.code.N) *
+                                                                            params.simulation.inter_frame_level : 0)),
+  Y_N_pck(this->params.simulation.n_threads, std::vector<uint64_t>(packed ? Bit_packer<B>::n_words(params.code.N) *
+                                                                            params.simulation.inter_frame_level : 0)),
+
+  U_K1_str(this->params.simulation.n_threads),
+  U_K2_str(this->params.simulation.n_threads),
+  U_K1_ref(this->params.simulation.n_threads, mipp::vector<B>(params.decoder.stream ?
+                                                             params.code.K_info * params.simulation.inter_frame_level :
+                                                             0)),
+  U_K2_ref(this->params.simulation.n_threads, mipp::vector<B>(params.decoder.stream ?
+                                                             params.code.K      * params.simulation.inter_frame_level :
+                                                             0))
 {
 #ifdef ENABLE_MPI
 	if (params.simulation.debug || params.simulation.benchs)
 		throw runtime_error(__FILE__, __LINE__, __func__, "The debug and bench modes are unavailable in MPI.");
 #endif
 
+	if (params.decoder.stream && (params.simulation.debug || params.monitor.err_track_enable))
+		throw runtime_error(__FILE__, __LINE__, __func__, "The debug mode and the error tracking are unavailable with "
+		                                                  "the streaming decoding.");
+
 	if (this->params.monitor.err_track_revert)
 	{
 		if (this->params.simulation.n_threads != 1)
@@ -59,6 +86,9 @@ Simulation_BFER_std_threads<B,R,Q>
 	this->data_sizes[std::make_pair(15, "Coset bit"   )] = this->V_K1[0].size();
 	this->data_sizes[std::make_pair(16, "CRC extract" )] = this->V_K2[0].size();
 	this->data_sizes[std::make_pair(17, "Check errors")] = this->V_K2[0].size();
+
+	if (this->packed)
+		this->data_sizes[std::make_pair(3, "Packing")] = this->X_N1[0].size();
 }
 
 template <typename B, typename R, typename Q>
@@ -146,6 +176,10 @@ void Simulation_BFER_std_threads<B,R,Q>
 {
 	if (this->params.simulation.benchs)
 		this->simulation_loop_bench(tid);
+	else if (this->packed)
+		this->simulation_loop_packed(tid);
+	else if (this->params.decoder.stream)
+		this->simulation_loop_stream(tid);
 	else
 		this->simulation_loop(tid);
 }
@@ -157,6 +191,147 @@ void Simulation_BFER_std_threads<B,R,Q>
 	using namespace std::chrono;
 	auto t_snr = steady_clock::now();
 
+	// simulation loop
+	while ((!this->monitor_red->fe_limit_achieved()) && // while max frame error count has not been reached
+	        (this->params.simulation.stop_time == seconds(0) ||
+	         (steady_clock::now() - t_snr) < this->params.simulation.stop_time))
+	{
+		// from the source to the decoder input Y_N5
+		this->transmit(tid);
+
+		// launch decoder
+		auto t_decod = steady_clock::now();
+		this->decoder[tid]->hard_decode(this->Y_N5[tid], this->V_K1[tid]);
+		this->durations[tid][std::make_pair(11, "Decoder" )] += steady_clock::now() - t_decod;
+		this->durations[tid][std::make_pair(12, "- load"  )] += this->decoder[tid]->get_load_duration();
+		this->durations[tid][std::make_pair(13, "- decode")] += this->decoder[tid]->get_decode_duration();
+		this->durations[tid][std::make_pair(14, "- store" )] += this->decoder[tid]->get_store_duration();
+
+		// apply the coset to recover the real bits
+		if (this->params.code.coset)
+		{
+			auto t_cobit = steady_clock::now();
+			this->coset_bit[tid]->apply(this->U_K2[tid], this->V_K1[tid], this->V_K1[tid]);
+			this->durations[tid][std::make_pair(15, "Coset bit")] += steady_clock::now() - t_cobit;
+		}
+
+		// extract the CRC bits and keep only the information bits
+		auto t_crcex = steady_clock::now();
+		this->crc[tid]->extract(this->V_K1[tid], this->V_K2[tid]);
+		this->durations[tid][std::make_pair(16, "CRC extract")] += steady_clock::now() - t_crcex;
+
+		// check errors in the frame
+		auto t_check = steady_clock::now();
+		this->monitor[tid]->check_errors(this->U_K1[tid], this->V_K2[tid]);
+		this->durations[tid][std::make_pair(17, "Check errors")] += steady_clock::now() - t_check;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void Simulation_BFER_std_threads<B,R,Q>
+::transmit(const int tid)
+{
+	using namespace std::chrono;
+
+	if (this->params.source.type != "AZCW")
+	{
+		// generate a random K bits vector U_K1
+		auto t_sourc = steady_clock::now();
+		this->source[tid]->generate(this->U_K1[tid]);
+		this->durations[tid][std::make_pair(0, "Source")] += steady_clock::now() - t_sourc;
+
+		// build the CRC from U_K1 into U_K2
+		auto t_crcbd = steady_clock::now();
+		this->crc[tid]->build(this->U_K1[tid], this->U_K2[tid]);
+		this->durations[tid][std::make_pair(1, "CRC build")] += steady_clock::now() - t_crcbd;
+
+		// encode U_K2 into a N bits vector X_N
+		auto t_encod = steady_clock::now();
+		this->encoder[tid]->encode(this->U_K2[tid], this->X_N1[tid]);
+		this->durations[tid][std::make_pair(2, "Encoder")] += steady_clock::now() - t_encod;
+
+		// puncture X_N1 into X_N2
+		auto t_punct = steady_clock::now();
+		this->puncturer[tid]->puncture(this->X_N1[tid], this->X_N2[tid]);
+		this->durations[tid][std::make_pair(3, "Puncturer")] += steady_clock::now() - t_punct;
+
+		// modulate
+		auto t_modul = steady_clock::now();
+		this->modem[tid]->modulate(this->X_N2[tid], this->X_N3[tid]);
+		this->durations[tid][std::make_pair(4, "Modulator")] += steady_clock::now() - t_modul;
+	}
+
+	// Rayleigh channel
+	if (this->params.channel.type.find("RAYLEIGH") != std::string::npos)
+	{
+		// add noise
+		auto t_chann = steady_clock::now();
+		this->channel[tid]->add_noise(this->X_N3[tid], this->Y_N1[tid], this->H_N[tid]);
+		this->durations[tid][std::make_pair(5, "Channel")] += steady_clock::now() - t_chann;
+
+		// filtering
+		auto t_filte = steady_clock::now();
+		this->modem[tid]->filter(this->Y_N1[tid], this->Y_N2[tid]);
+		this->durations[tid][std::make_pair(6, "Filter")] += steady_clock::now() - t_filte;
+
+		// demodulation
+		auto t_demod = steady_clock::now();
+		this->modem[tid]->demodulate_with_gains(this->Y_N2[tid], this->H_N[tid], this->Y_N3[tid]);
+		this->durations[tid][std::make_pair(7, "Demodulator")] += steady_clock::now() - t_demod;
+	}
+	else // additive channel (AWGN, USER, NO)
+	{
+		// add noise
+		auto t_chann = steady_clock::now();
+		this->channel[tid]->add_noise(this->X_N3[tid], this->Y_N1[tid]);
+		this->durations[tid][std::make_pair(5, "Channel")] += steady_clock::now() - t_chann;
+
+		// filtering
+		auto t_filte = steady_clock::now();
+		this->modem[tid]->filter(this->Y_N1[tid], this->Y_N2[tid]);
+		this->durations[tid][std::make_pair(6, "Filter")] += steady_clock::now() - t_filte;
+
+		// demodulation
+		auto t_demod = steady_clock::now();
+		this->modem[tid]->demodulate(this->Y_N2[tid], this->Y_N3[tid]);
+		this->durations[tid][std::make_pair(7, "Demodulator")] += steady_clock::now() - t_demod;
+	}
+
+	// make the quantization
+	auto t_quant = steady_clock::now();
+	this->quantizer[tid]->process(this->Y_N3[tid], this->Y_N4[tid]);
+	this->durations[tid][std::make_pair(8, "Quantizer")] += steady_clock::now() - t_quant;
+
+	// depuncture before the decoding stage
+	auto t_depun = steady_clock::now();
+	this->puncturer[tid]->depuncture(this->Y_N4[tid], this->Y_N5[tid]);
+	this->durations[tid][std::make_pair(9, "Depuncturer")] += steady_clock::now() - t_depun;
+
+	// apply the coset: the decoder will believe to a AZCW
+	if (this->params.code.coset)
+	{
+		auto t_corea = steady_clock::now();
+		this->coset_real[tid]->apply(this->X_N1[tid], this->Y_N5[tid], this->Y_N5[tid]);
+		this->durations[tid][std::make_pair(10, "Coset real")] += steady_clock::now() - t_corea;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void Simulation_BFER_std_threads<B,R,Q>
+::simulation_loop_packed(const int tid)
+{
+	using namespace std::chrono;
+	auto t_snr = steady_clock::now();
+
+	auto channel_bin = dynamic_cast<Channel_binary<R>*>(this->channel[tid]);
+	if (channel_bin == nullptr)
+	{
+		std::stringstream message;
+		message << "The hard decision chain requires a binary channel ('params.channel.type' = "
+		        << this->params.channel.type << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
 	// simulation loop
 	while ((!this->monitor_red->fe_limit_achieved()) && // while max frame error count has not been reached
 	        (this->params.simulation.stop_time == seconds(0) ||
@@ -166,7 +341,15 @@ void Simulation_BFER_std_threads<B,R,Q>
 		{
 			// generate a random K bits vector U_K1
 			auto t_sourc = steady_clock::now();
-			this->source[tid]->generate(this->U_K1[tid]);
+			if (!this->U_K_pck[tid].empty())
+			{
+				// the random sources draw 32 bits at once in the packed representation
+				this->source[tid]->generate_packed(this->U_K_pck[tid]);
+				Bit_packer<B>::unpack_words(this->U_K_pck[tid].data(), this->U_K1[tid].data(),
+				                            this->params.code.K_info, this->params.simulation.inter_frame_level);
+			}
+			else
+				this->source[tid]->generate(this->U_K1[tid]);
 			this->durations[tid][std::make_pair(0, "Source")] += steady_clock::now() - t_sourc;
 
 			// build the CRC from U_K1 into U_K2
@@ -179,84 +362,96 @@ void Simulation_BFER_std_threads<B,R,Q>
 			this->encoder[tid]->encode(this->U_K2[tid], this->X_N1[tid]);
 			this->durations[tid][std::make_pair(2, "Encoder")] += steady_clock::now() - t_encod;
 
-			// puncture X_N1 into X_N2
-			auto t_punct = steady_clock::now();
-			this->puncturer[tid]->puncture(this->X_N1[tid], this->X_N2[tid]);
-			this->durations[tid][std::make_pair(3, "Puncturer")] += steady_clock::now() - t_punct;
-
-			// modulate
-			auto t_modul = steady_clock::now();
-			this->modem[tid]->modulate(this->X_N2[tid], this->X_N3[tid]);
-			this->durations[tid][std::make_pair(4, "Modulator")] += steady_clock::now() - t_modul;
+			// pack X_N1 into 64-bit words (there is no puncturing in the hard decision chain)
+			auto t_packi = steady_clock::now();
+			Bit_packer<B>::pack_words(this->X_N1[tid].data(), this->X_N_pck[tid].data(), this->params.code.N,
+			                          this->params.simulation.inter_frame_level);
+			this->durations[tid][std::make_pair(3, "Packing")] += steady_clock::now() - t_packi;
 		}
 
-		// Rayleigh channel
-		if (this->params.channel.type.find("RAYLEIGH") != std::string::npos)
-		{
-			// add noise
-			auto t_chann = steady_clock::now();
-			this->channel[tid]->add_noise(this->X_N3[tid], this->Y_N1[tid], this->H_N[tid]);
-			this->durations[tid][std::make_pair(5, "Channel")] += steady_clock::now() - t_chann;
-
-			// filtering
-			auto t_filte = steady_clock::now();
-			this->modem[tid]->filter(this->Y_N1[tid], this->Y_N2[tid]);
-			this->durations[tid][std::make_pair(6, "Filter")] += steady_clock::now() - t_filte;
-
-			// demodulation
-			auto t_demod = steady_clock::now();
-			this->modem[tid]->demodulate_with_gains(this->Y_N2[tid], this->H_N[tid], this->Y_N3[tid]);
-			this->durations[tid][std::make_pair(7, "Demodulator")] += steady_clock::now() - t_demod;
-		}
-		else // additive channel (AWGN, USER, NO)
-		{
-			// add noise
-			auto t_chann = steady_clock::now();
-			this->channel[tid]->add_noise(this->X_N3[tid], this->Y_N1[tid]);
-			this->durations[tid][std::make_pair(5, "Channel")] += steady_clock::now() - t_chann;
-
-			// filtering
-			auto t_filte = steady_clock::now();
-			this->modem[tid]->filter(this->Y_N1[tid], this->Y_N2[tid]);
-			this->durations[tid][std::make_pair(6, "Filter")] += steady_clock::now() - t_filte;
-
-			// demodulation
-			auto t_demod = steady_clock::now();
-			this->modem[tid]->demodulate(this->Y_N2[tid], this->Y_N3[tid]);
-			this->durations[tid][std::make_pair(7, "Demodulator")] += steady_clock::now() - t_demod;
-		}
+		// flip or erase the packed bits (no modulation: the events are drawn directly on the bits)
+		auto t_chann = steady_clock::now();
+		channel_bin->add_noise_packed(this->X_N_pck[tid].data(), this->Y_N_pck[tid].data());
+		this->durations[tid][std::make_pair(5, "Channel")] += steady_clock::now() - t_chann;
+
+		// launch decoder on the hard decisions
+		auto t_decod = steady_clock::now();
+		this->decoder[tid]->hard_decode_packed(this->Y_N_pck[tid], this->V_K1[tid]);
+		this->durations[tid][std::make_pair(11, "Decoder" )] += steady_clock::now() - t_decod;
+		this->durations[tid][std::make_pair(12, "- load"  )] += this->decoder[tid]->get_load_duration();
+		this->durations[tid][std::make_pair(13, "- decode")] += this->decoder[tid]->get_decode_duration();
+		this->durations[tid][std::make_pair(14, "- store" )] += this->decoder[tid]->get_store_duration();
+
+		// extract the CRC bits and keep only the information bits
+		auto t_crcex = steady_clock::now();
+		this->crc[tid]->extract(this->V_K1[tid], this->V_K2[tid]);
+		this->durations[tid][std::make_pair(16, "CRC extract")] += steady_clock::now() - t_crcex;
+
+		// check errors in the frame
+		auto t_check = steady_clock::now();
+		this->monitor[tid]->check_errors(this->U_K1[tid], this->V_K2[tid]);
+		this->durations[tid][std::make_pair(17, "Check errors")] += steady_clock::now() - t_check;
+	}
+}
+
+template <typename B, typename R, typename Q>
+void Simulation_BFER_std_threads<B,R,Q>
+::simulation_loop_stream(const int tid)
+{
+	using namespace std::chrono;
+	auto t_snr = steady_clock::now();
+
+	const auto n_frames = this->params.simulation.inter_frame_level;
+	const auto K_info   = this->params.code.K_info;
+	const auto K        = this->params.code.K;
+	const auto N_code   = this->params.code.N_code;
+
+	auto &U_K1_frames = this->U_K1_str[tid];
+	auto &U_K2_frames = this->U_K2_str[tid];
+
+	uint64_t n_pushed = 0; // identifier of the next frame given to the decoder
+	uint64_t n_pulled = 0; // number of frames given back by the decoder
+	int      n_ready  = 0; // number of decoded frames waiting to be checked (in V_K1)
 
-		// make the quantization
-		auto t_quant = steady_clock::now();
-		this->quantizer[tid]->process(this->Y_N3[tid], this->Y_N4[tid]);
-		this->durations[tid][std::make_pair(8, "Quantizer")] += steady_clock::now() - t_quant;
+	// gets a decoded frame, puts it with its reference bits and checks the errors once 'n_frames' frames are ready
+	auto pull = [&]() -> bool
+	{
+		uint64_t frame_id;
+		auto t_decod = steady_clock::now();
+		const auto is_pulled = this->decoder[tid]->pull_frame(this->V_K1[tid].data() + n_ready * K, frame_id);
+		this->durations[tid][std::make_pair(11, "Decoder")] += steady_clock::now() - t_decod;
+
+		if (!is_pulled)
+			return false;
 
-		// depuncture before the decoding stage
-		auto t_depun = steady_clock::now();
-		this->puncturer[tid]->depuncture(this->Y_N4[tid], this->Y_N5[tid]);
-		this->durations[tid][std::make_pair(9, "Depuncturer")] += steady_clock::now() - t_depun;
+		// re-associate the decoded frame with the bits it has been encoded from
+		auto U_K1_it = U_K1_frames.find(frame_id);
+		if (U_K1_it == U_K1_frames.end())
+		{
+			std::stringstream message;
+			message << "The decoder gave back an unknown frame ('frame_id' = " << frame_id << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+		std::copy(U_K1_it->second.begin(), U_K1_it->second.end(), this->U_K1_ref[tid].begin() + n_ready * K_info);
+		U_K1_frames.erase(U_K1_it);
 
-		// apply the coset: the decoder will believe to a AZCW
 		if (this->params.code.coset)
 		{
-			auto t_corea = steady_clock::now();
-			this->coset_real[tid]->apply(this->X_N1[tid], this->Y_N5[tid], this->Y_N5[tid]);
-			this->durations[tid][std::make_pair(10, "Coset real")] += steady_clock::now() - t_corea;
+			auto U_K2_it = U_K2_frames.find(frame_id);
+			std::copy(U_K2_it->second.begin(), U_K2_it->second.end(), this->U_K2_ref[tid].begin() + n_ready * K);
+			U_K2_frames.erase(U_K2_it);
 		}
 
-		// launch decoder
-		auto t_decod = steady_clock::now();
-		this->decoder[tid]->hard_decode(this->Y_N5[tid], this->V_K1[tid]);
-		this->durations[tid][std::make_pair(11, "Decoder" )] += steady_clock::now() - t_decod;
-		this->durations[tid][std::make_pair(12, "- load"  )] += this->decoder[tid]->get_load_duration();
-		this->durations[tid][std::make_pair(13, "- decode")] += this->decoder[tid]->get_decode_duration();
-		this->durations[tid][std::make_pair(14, "- store" )] += this->decoder[tid]->get_store_duration();
+		n_pulled++;
+		if (++n_ready < n_frames)
+			return true;
+		n_ready = 0;
 
 		// apply the coset to recover the real bits
 		if (this->params.code.coset)
 		{
 			auto t_cobit = steady_clock::now();
-			this->coset_bit[tid]->apply(this->U_K2[tid], this->V_K1[tid], this->V_K1[tid]);
+			this->coset_bit[tid]->apply(this->U_K2_ref[tid], this->V_K1[tid], this->V_K1[tid]);
 			this->durations[tid][std::make_pair(15, "Coset bit")] += steady_clock::now() - t_cobit;
 		}
 
@@ -265,11 +460,45 @@ void Simulation_BFER_std_threads<B,R,Q>
 		this->crc[tid]->extract(this->V_K1[tid], this->V_K2[tid]);
 		this->durations[tid][std::make_pair(16, "CRC extract")] += steady_clock::now() - t_crcex;
 
-		// check errors in the frame
+		// check errors in the frames
 		auto t_check = steady_clock::now();
-		this->monitor[tid]->check_errors(this->U_K1[tid], this->V_K2[tid]);
+		this->monitor[tid]->check_errors(this->U_K1_ref[tid], this->V_K2[tid]);
 		this->durations[tid][std::make_pair(17, "Check errors")] += steady_clock::now() - t_check;
+
+		return true;
+	};
+
+	// simulation loop
+	while ((!this->monitor_red->fe_limit_achieved()) && // while max frame error count has not been reached
+	        (this->params.simulation.stop_time == seconds(0) ||
+	         (steady_clock::now() - t_snr) < this->params.simulation.stop_time))
+	{
+		// from the source to the decoder input Y_N5
+		this->transmit(tid);
+
+		// give the frames to the decoder with an identifier and keep their reference bits
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto frame_id = n_pushed++;
+			U_K1_frames[frame_id].assign(this->U_K1[tid].begin() + (f +0) * K_info,
+			                             this->U_K1[tid].begin() + (f +1) * K_info);
+			if (this->params.code.coset)
+				U_K2_frames[frame_id].assign(this->U_K2[tid].begin() + (f +0) * K,
+				                             this->U_K2[tid].begin() + (f +1) * K);
+
+			auto t_decod = steady_clock::now();
+			this->decoder[tid]->push_frame(this->Y_N5[tid].data() + f * N_code, frame_id);
+			this->durations[tid][std::make_pair(11, "Decoder")] += steady_clock::now() - t_decod;
+		}
+
+		// keep at least 'n_frames' frames in the decoder (lanes + input queue): a lane is refilled as soon as its frame
+		// is decoded, without waiting for the other lanes
+		while (n_pushed - n_pulled > (uint64_t)n_frames)
+			pull();
 	}
+
+	// decode the remaining frames (the number of pushed frames is a multiple of 'n_frames')
+	while (pull());
 }
 
 template <typename B, typename R, typename Q>
@@ -453,6 +682,33 @@ void Simulation_BFER_std_threads<B,R,Q>
 	this->mutex_debug.unlock();
 }
 
+template <typename B, typename R, typename Q>
+bool Simulation_BFER_std_threads<B,R,Q>
+::is_packed_chain(const parameters& params)
+{
+	// the decoders which implement the hard decision decoding of packed bits (see Decoder::hard_decode_packed)
+	const auto hard_decoder = (params.decoder.type == "ALGEBRAIC") ||
+	                          ((params.decoder.type == "BP" || params.decoder.type == "BP_FLOODING") &&
+	                            params.decoder.implem == "GALA");
+
+	// a BPSK hard decision on a BSC is the channel itself: the modem and the quantizer can be skipped (not on a BEC:
+	// the packed hard decisions can't tell an erased bit from a 0 and the BEC would be simulated as a Z-channel)
+	return params.channel.type == "BSC"                 &&
+	       params.modulator.type == "BPSK"              &&
+	       params.code.N == params.code.N_code          && // no puncturing
+	      !params.code.coset                            &&
+	      !params.simulation.debug                      &&
+	       hard_decoder;
+}
+
+template <typename B, typename R, typename Q>
+bool Simulation_BFER_std_threads<B,R,Q>
+::is_packed_source(const parameters& params)
+{
+	// the random sources implement Source::generate_packed (the AZCW frames are generated once)
+	return is_packed_chain(params) && (params.source.type == "RAND" || params.source.type == "RAND_FAST");
+}
+
 template <typename B, typename R, typename Q>
 Terminal_BFER<B>* Simulation_BFER_std_threads<B,R,Q>
 ::build_terminal()
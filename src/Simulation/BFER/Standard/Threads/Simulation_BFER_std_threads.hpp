@@ -1,9 +1,11 @@
 #ifndef SIMULATION_BFER_STD_THREADS_HPP_
 #define SIMULATION_BFER_STD_THREADS_HPP_
 
+#include <map>
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <cstdint>
 #include <mipp.h>
 
 #include "../Simulation_BFER_std.hpp"
@@ -20,6 +22,9 @@ protected:
 
 	std::mutex mutex_debug;
 
+	// true when the hard decision chain on packed bits replaces the modulation, the demodulation and the quantization
+	const bool packed;
+
 	// data vector
 	std::vector<mipp::vector<B>> U_K1; // information bit vector
 	std::vector<mipp::vector<B>> U_K2; // information bit vector + CRC bits
@@ -35,6 +40,17 @@ protected:
 	std::vector<mipp::vector<B>> V_K1; // decoded bits + CRC bits
 	std::vector<mipp::vector<B>> V_K2; // decoded bits
 
+	// packed data vector (hard decision chain)
+	std::vector<std::vector<uint64_t>> U_K_pck; // information bits       (packed in 64-bit words, random sources)
+	std::vector<std::vector<uint64_t>> X_N_pck; // encoded and punctured codeword (bits packed in 64-bit words)
+	std::vector<std::vector<uint64_t>> Y_N_pck; // noisy codeword           (hard decisions packed in 64-bit words)
+
+	// streaming decoding: the frames are decoded out of order, the reference bits are kept per frame identifier
+	std::vector<std::map<uint64_t,std::vector<B>>> U_K1_str; // information bits of the frames being decoded
+	std::vector<std::map<uint64_t,std::vector<B>>> U_K2_str; // information bits + CRC bits (coset only)
+	std::vector<mipp::vector<B>>                   U_K1_ref; // information bits of the decoded frames
+	std::vector<mipp::vector<B>>                   U_K2_ref; // information bits + CRC bits of the decoded frames
+
 public:
 	Simulation_BFER_std_threads(const tools::parameters& params, tools::Codec<B,Q> &codec);
 	virtual ~Simulation_BFER_std_threads();
@@ -46,11 +62,18 @@ protected:
 
 private:
 	void Monte_Carlo_method   (const int tid = 0);
-	void simulation_loop      (const int tid = 0);
-	void simulation_loop_bench(const int tid = 0);
+	void simulation_loop       (const int tid = 0);
+	void simulation_loop_packed(const int tid = 0);
+	void simulation_loop_stream(const int tid = 0);
+	void simulation_loop_bench (const int tid = 0);
+
+	void transmit(const int tid = 0);
 
 	void display_debug();
 
+	static bool is_packed_chain (const tools::parameters& params);
+	static bool is_packed_source(const tools::parameters& params);
+
 	static void start_thread(Simulation_BFER_std_threads<B,R,Q> *simu, const int tid = 0);
 };
 }
@@ -487,7 +487,10 @@ Channel<R>* Simulation_EXIT<B,R>
 	                                 this->params.channel.path,
 	                                 params.simulation.seed,
 	                                 this->sigma,
-	                                 this->params.simulation.inter_frame_level);
+	                                 this->params.simulation.inter_frame_level,
+	                                 this->params.channel.doppler,
+	                                 this->params.channel.n_sin,
+	                                 this->params.channel.probability);
 }
 
 template <typename B, typename R>
@@ -502,7 +505,9 @@ Channel<R>* Simulation_EXIT<B,R>
 	                                 this->params.channel.path,
 	                                 params.simulation.seed,
 	                                 2.f / sig_a,
-	                                 this->params.simulation.inter_frame_level);
+	                                 this->params.simulation.inter_frame_level,
+	                                 this->params.channel.doppler,
+	                                 this->params.channel.n_sin);
 }
 
 template <typename B, typename R>
@@ -0,0 +1,188 @@
+#if defined(__linux__) || defined(__linux) || defined(__APPLE__) || defined(__unix__)
+#define BINARY_FILE_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Binary_file.hpp"
+
+using namespace aff3ct::tools;
+
+static const uint64_t fnv_basis = 0xcbf29ce484222325ULL;
+static const uint64_t fnv_prime = 0x100000001b3ULL;
+
+const size_t Binary_file::magic_size;
+
+Binary_file
+::Binary_file(const std::string &path)
+: path(path), data(nullptr), size(0), is_mapped(false)
+{
+#ifdef BINARY_FILE_MMAP
+	const auto fd = ::open(path.c_str(), O_RDONLY);
+	struct stat st;
+	if (fd < 0 || ::fstat(fd, &st) || st.st_size <= 0)
+	{
+		if (fd >= 0) ::close(fd);
+
+		std::stringstream message;
+		message << "Impossible to open the '" << path << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto mapping = ::mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		std::stringstream message;
+		message << "Impossible to map the '" << path << "' file in memory.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->data      = (const char*)mapping;
+	this->size      = (size_t)st.st_size;
+	this->is_mapped = true;
+#else
+	std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the '" << path << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->size = (size_t)file.tellg();
+	this->buffer.resize((this->size + sizeof(uint64_t) -1) / sizeof(uint64_t));
+	file.seekg(0);
+	if (!file.read((char*)this->buffer.data(), this->size))
+	{
+		std::stringstream message;
+		message << "Impossible to read the '" << path << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->data = (const char*)this->buffer.data();
+#endif
+}
+
+Binary_file
+::~Binary_file()
+{
+#ifdef BINARY_FILE_MMAP
+	if (this->is_mapped)
+		::munmap((void*)this->data, this->size);
+#endif
+}
+
+const uint32_t* Binary_file
+::get_words(const std::string &magic, size_t &n_words) const
+{
+	check_magic(magic);
+
+	const auto n_fixed = magic_size + sizeof(uint64_t);
+	if (this->size < n_fixed || std::memcmp(this->data, magic.data(), magic_size))
+	{
+		std::stringstream message;
+		message << "The '" << this->path << "' file does not start with the '" << magic << "' magic.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if ((this->size - n_fixed) % sizeof(uint32_t))
+	{
+		std::stringstream message;
+		message << "The size of the '" << this->path << "' file is not a whole number of 32-bit words ('size' = "
+		        << this->size << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the words start on a 64-bit boundary of the data (the mapping itself is page aligned)
+	const auto words = reinterpret_cast<const uint32_t*>(this->data + n_fixed);
+	n_words = (this->size - n_fixed) / sizeof(uint32_t);
+
+	uint64_t h;
+	std::memcpy(&h, this->data + magic_size, sizeof(uint64_t));
+	if (h != checksum(words, n_words))
+	{
+		std::stringstream message;
+		message << "The checksum of the '" << this->path << "' file is wrong (the file is corrupted).";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	return words;
+}
+
+bool Binary_file
+::has_magic(const std::string &path, const std::string &magic)
+{
+	check_magic(magic);
+
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+
+	char first[magic_size];
+	return file.read(first, sizeof(first)) && !std::memcmp(first, magic.data(), magic_size);
+}
+
+void Binary_file
+::write(const std::string &path, const std::string &magic, const std::vector<uint32_t> &words)
+{
+	check_magic(magic);
+
+	const uint64_t h = checksum(words.data(), words.size());
+
+#ifdef BINARY_FILE_MMAP
+	const auto tmp_path = path + ".tmp" + std::to_string((long long)::getpid());
+#else
+	const auto tmp_path = path + ".tmp";
+#endif
+	std::ofstream file(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the '" << tmp_path << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file.write(magic.data(), magic_size);
+	file.write((const char*)&h, sizeof(h));
+	file.write((const char*)words.data(), words.size() * sizeof(uint32_t));
+	file.close();
+
+	if (!file || std::rename(tmp_path.c_str(), path.c_str()))
+	{
+		std::remove(tmp_path.c_str());
+
+		std::stringstream message;
+		message << "Impossible to write the '" << path << "' file.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+uint64_t Binary_file
+::checksum(const uint32_t *words, const size_t n_words)
+{
+	// FNV-1a on the 32-bit words (instead of the bytes): the files can have millions of words
+	auto h = fnv_basis;
+	for (size_t i = 0; i < n_words; i++)
+		h = (h ^ (uint64_t)words[i]) * fnv_prime;
+	return h;
+}
+
+void Binary_file
+::check_magic(const std::string &magic)
+{
+	if (magic.size() != magic_size)
+	{
+		std::stringstream message;
+		message << "'magic.size()' has to be equal to 'magic_size' ('magic.size()' = " << magic.size()
+		        << ", 'magic_size' = " << magic_size << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
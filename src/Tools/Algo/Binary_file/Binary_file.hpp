@@ -0,0 +1,69 @@
+#ifndef BINARY_FILE_HPP_
+#define BINARY_FILE_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Binary file of 32-bit words framed by a magic and a checksum (native endianness):
+ *   magic (8 bytes) | checksum (64-bit) | words[n_words]
+ * The checksum is a 64-bit FNV-1a hash of the words. The whole file is mapped in memory when the platform supports it
+ * (read in a buffer otherwise) for the lifetime of the object, the words start on a 64-bit boundary.
+ */
+class Binary_file
+{
+public:
+	static const size_t magic_size = 8;
+
+private:
+	const std::string path;
+
+	const char *data;
+	size_t      size;
+	bool        is_mapped;
+
+	std::vector<uint64_t> buffer; // the file content when it is not mapped
+
+public:
+	/*
+	 * Map (or read) the 'path' file, throw a runtime_error if it can't be opened.
+	 */
+	explicit Binary_file(const std::string &path);
+
+	Binary_file(const Binary_file&) = delete;
+	Binary_file& operator=(const Binary_file&) = delete;
+
+	virtual ~Binary_file();
+
+	/*
+	 * Return the words of the file, throw a runtime_error if the file does not start with 'magic' (of 'magic_size'
+	 * characters), if its size is not a whole number of words or if the checksum does not match the words.
+	 */
+	const uint32_t* get_words(const std::string &magic, size_t &n_words) const;
+
+	/*
+	 * Return true if the 'path' file starts with 'magic' (false if it can't be opened).
+	 */
+	static bool has_magic(const std::string &path, const std::string &magic);
+
+	/*
+	 * Write 'magic', the checksum and 'words' in the 'path' file. The file is written under a temporary name and then
+	 * renamed: concurrent readers never see a partially written file.
+	 */
+	static void write(const std::string &path, const std::string &magic, const std::vector<uint32_t> &words);
+
+	static uint64_t checksum(const uint32_t *words, const size_t n_words);
+
+private:
+	static void check_magic(const std::string &magic);
+};
+}
+}
+
+#endif /* BINARY_FILE_HPP_ */
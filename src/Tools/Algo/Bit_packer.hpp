@@ -9,7 +9,9 @@
 #define BIT_PACKER_HPP_
 
 #include <cmath>
+#include <cstdint>
 #include <sstream>
+#include <algorithm>
 #include <mipp.h>
 
 #include "Tools/Exception/exception.hpp"
@@ -214,6 +216,78 @@ struct Bit_packer
 		}
 	}
 
+	/*!
+	 * \brief Gets the number of 64-bit words needed to store 'n_bits' packed bits.
+	 *
+	 * \param n_bits: the number of bits.
+	 */
+	static inline int n_words(const int n_bits)
+	{
+		return (n_bits + 63) / 64;
+	}
+
+	/*!
+	 * \brief Packs bits in 64-bit words.
+	 *
+	 * The bit 'i' of a frame is stored in the bit 'i % 64' of the word 'i / 64', each frame starts on a new word and
+	 * the unused bits of the last word of a frame are set to 0.
+	 *
+	 * \param vec_in:           an input vector of unpacked bits (only 1 bit per data is used to transport data).
+	 * \param words_out:        an output vector of packed bits ('n_words(n_bits_per_frame)' words per frame).
+	 * \param n_bits_per_frame: the number of bits in one frame.
+	 * \param n_frames:         the number of frames to pack.
+	 */
+	static inline void pack_words(const B *vec_in, uint64_t *words_out, const int n_bits_per_frame,
+	                              const int n_frames = 1)
+	{
+		const auto n_words_per_frame = Bit_packer<B>::n_words(n_bits_per_frame);
+
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto in  = vec_in    + f * n_bits_per_frame;
+			const auto out = words_out + f * n_words_per_frame;
+
+			for (auto w = 0; w < n_words_per_frame; w++)
+			{
+				const auto n_bits = std::min(64, n_bits_per_frame - w * 64);
+
+				uint64_t word = 0;
+				for (auto j = 0; j < n_bits; j++)
+					word |= (uint64_t)(in[w * 64 +j] != 0) << j;
+				out[w] = word;
+			}
+		}
+	}
+
+	/*!
+	 * \brief Unpacks bits from 64-bit words (see 'pack_words' for the storage order).
+	 *
+	 * \param words_in:         an input vector of packed bits ('n_words(n_bits_per_frame)' words per frame).
+	 * \param vec_out:          an output vector of unpacked bits.
+	 * \param n_bits_per_frame: the number of bits in one frame.
+	 * \param n_frames:         the number of frames to unpack.
+	 */
+	static inline void unpack_words(const uint64_t *words_in, B *vec_out, const int n_bits_per_frame,
+	                                const int n_frames = 1)
+	{
+		const auto n_words_per_frame = Bit_packer<B>::n_words(n_bits_per_frame);
+
+		for (auto f = 0; f < n_frames; f++)
+		{
+			const auto in  = words_in + f * n_words_per_frame;
+			const auto out = vec_out  + f * n_bits_per_frame;
+
+			for (auto w = 0; w < n_words_per_frame; w++)
+			{
+				const auto n_bits = std::min(64, n_bits_per_frame - w * 64);
+				const auto word   = in[w];
+
+				for (auto j = 0; j < n_bits; j++)
+					out[w * 64 +j] = (B)((word >> j) & 1);
+			}
+		}
+	}
+
 private:
 	static inline void _pack(const B* vec_in, unsigned char* bytes_out, const int n_bits, const bool rev = false)
 	{
@@ -0,0 +1,49 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Bucket_queue.hpp"
+
+using namespace aff3ct::tools;
+
+Bucket_queue
+::Bucket_queue(const int n_elements, const int n_buckets)
+: n_elements(n_elements),
+  n_buckets (n_buckets ),
+  heads     (n_buckets  > 0 ? n_buckets  : 0, -1),
+  next      (n_elements > 0 ? n_elements : 0, -1),
+  prev      (n_elements > 0 ? n_elements : 0, -1),
+  buckets   (n_elements > 0 ? n_elements : 0, -1),
+  top       (0),
+  n_queued  (0)
+{
+	if (n_elements <= 0)
+	{
+		std::stringstream message;
+		message << "'n_elements' has to be greater than 0 ('n_elements' = " << n_elements << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_buckets <= 0)
+	{
+		std::stringstream message;
+		message << "'n_buckets' has to be greater than 0 ('n_buckets' = " << n_buckets << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Bucket_queue
+::~Bucket_queue()
+{
+}
+
+void Bucket_queue
+::clear()
+{
+	std::fill(heads  .begin(), heads  .end(), -1);
+	std::fill(buckets.begin(), buckets.end(), -1);
+
+	top      = 0;
+	n_queued = 0;
+}
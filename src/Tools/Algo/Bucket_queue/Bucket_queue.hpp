@@ -0,0 +1,55 @@
+#ifndef BUCKET_QUEUE_HPP_
+#define BUCKET_QUEUE_HPP_
+
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Priority queue of the elements [0, n_elements[ with integer priorities (the buckets) in [0, n_buckets[. Each bucket
+ * is a doubly linked list, so changing the priority of an element is O(1) and 'pop' only looks for the highest
+ * non-empty bucket below the last known one. The order of the elements inside a bucket is not kept: the elements of a
+ * bucket are equivalent (a coarse quantization of the priorities makes the queue approximate but cheap to update).
+ */
+class Bucket_queue
+{
+private:
+	const int n_elements;
+	const int n_buckets;
+
+	std::vector<int> heads;   // first element of each bucket (-1 when the bucket is empty)
+	std::vector<int> next;    // next     element in the same bucket (-1 for the last  one)
+	std::vector<int> prev;    // previous element in the same bucket (-1 for the first one)
+	std::vector<int> buckets; // bucket of each element (-1 when the element is not in the queue)
+
+	int top;                  // the buckets above 'top' are empty
+	int n_queued;             // number of elements in the queue
+
+public:
+	Bucket_queue(const int n_elements, const int n_buckets);
+	virtual ~Bucket_queue();
+
+	// removes all the elements from the queue
+	void clear();
+
+	// inserts the element 'elt' in the bucket 'bucket' (or moves it if it is already in the queue)
+	inline void update(const int elt, const int bucket);
+
+	// removes the element 'elt' from the queue (nothing is done if it is not in the queue)
+	inline void remove(const int elt);
+
+	// removes and returns an element of the highest non-empty bucket (-1 if the queue is empty)
+	inline int pop();
+
+	inline bool empty() const;
+	inline int  size () const;
+	inline int  get_bucket(const int elt) const;
+};
+}
+}
+
+#include "Bucket_queue.hxx"
+
+#endif /* BUCKET_QUEUE_HPP_ */
@@ -0,0 +1,73 @@
+#include "Bucket_queue.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Bucket_queue
+::update(const int elt, const int bucket)
+{
+	if (buckets[elt] == bucket)
+		return;
+
+	this->remove(elt);
+
+	prev[elt] = -1;
+	next[elt] = heads[bucket];
+	if (heads[bucket] >= 0)
+		prev[heads[bucket]] = elt;
+	heads[bucket] = elt;
+
+	buckets[elt] = bucket;
+	top = bucket > top ? bucket : top;
+	n_queued++;
+}
+
+void Bucket_queue
+::remove(const int elt)
+{
+	const auto bucket = buckets[elt];
+	if (bucket < 0)
+		return;
+
+	if (prev[elt] >= 0) next[prev[elt]] = next[elt]; else heads[bucket] = next[elt];
+	if (next[elt] >= 0) prev[next[elt]] = prev[elt];
+
+	buckets[elt] = -1;
+	n_queued--;
+}
+
+int Bucket_queue
+::pop()
+{
+	if (n_queued == 0)
+		return -1;
+
+	while (heads[top] < 0)
+		top--;
+
+	const auto elt = heads[top];
+	this->remove(elt);
+
+	return elt;
+}
+
+bool Bucket_queue
+::empty() const
+{
+	return n_queued == 0;
+}
+
+int Bucket_queue
+::size() const
+{
+	return n_queued;
+}
+
+int Bucket_queue
+::get_bucket(const int elt) const
+{
+	return buckets[elt];
+}
+}
+}
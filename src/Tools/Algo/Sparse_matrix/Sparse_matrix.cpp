@@ -1,8 +1,8 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <utility>
 #include <algorithm>
-#include <sstream>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -19,8 +19,103 @@ Sparse_matrix
   cols_max_degree(0     ),
   n_connections  (0     ),
   row_to_cols    (n_rows),
-  col_to_rows    (n_cols)
+  col_to_rows    (n_cols),
+  flat           (false )
+{
+}
+
+Sparse_matrix
+::Sparse_matrix(const unsigned n_rows, const unsigned n_cols,
+                const unsigned *row_offsets, const unsigned *row_cols,
+                const unsigned *col_offsets, const unsigned *col_rows)
+: n_rows         (n_rows                                        ),
+  n_cols         (n_cols                                        ),
+  rows_max_degree(0                                             ),
+  cols_max_degree(0                                             ),
+  n_connections  (row_offsets[n_rows]                           ),
+  row_offsets    (row_offsets, row_offsets + n_rows +1          ),
+  row_cols       (row_cols,    row_cols    + row_offsets[n_rows]),
+  col_offsets    (col_offsets, col_offsets + n_cols +1          ),
+  col_rows       (col_rows,    col_rows    + col_offsets[n_cols]),
+  flat           (true                                          )
 {
+	if (row_offsets[n_rows] != col_offsets[n_cols])
+	{
+		std::stringstream message;
+		message << "'row_offsets[n_rows]' has to be equal to 'col_offsets[n_cols]' ('row_offsets[n_rows]' = "
+		        << row_offsets[n_rows] << ", 'col_offsets[n_cols]' = " << col_offsets[n_cols] << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (unsigned r = 0; r < n_rows; r++)
+		this->rows_max_degree = std::max(this->rows_max_degree, row_offsets[r +1] - row_offsets[r]);
+	for (unsigned c = 0; c < n_cols; c++)
+		this->cols_max_degree = std::max(this->cols_max_degree, col_offsets[c +1] - col_offsets[c]);
+}
+
+Sparse_matrix
+::Sparse_matrix(const unsigned n_rows, const unsigned n_cols, const unsigned *row_offsets, const unsigned *row_cols)
+: n_rows         (n_rows                                        ),
+  n_cols         (n_cols                                        ),
+  rows_max_degree(0                                             ),
+  cols_max_degree(0                                             ),
+  n_connections  (row_offsets[n_rows]                           ),
+  row_offsets    (row_offsets, row_offsets + n_rows +1          ),
+  row_cols       (row_cols,    row_cols    + row_offsets[n_rows]),
+  col_offsets    (n_cols +1, 0                                  ),
+  col_rows       (row_offsets[n_rows]                           ),
+  flat           (true                                          )
+{
+	for (unsigned r = 0; r < n_rows; r++)
+		if (row_offsets[r] > row_offsets[r +1] || (r == 0 && row_offsets[0] != 0))
+		{
+			std::stringstream message;
+			message << "'row_offsets' has to start at 0 and to be non-decreasing ('r' = " << r
+			        << ", 'row_offsets[r]' = " << row_offsets[r] << ", 'row_offsets[r +1]' = " << row_offsets[r +1]
+			        << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	for (unsigned k = 0; k < this->n_connections; k++)
+	{
+		if (row_cols[k] >= n_cols)
+		{
+			std::stringstream message;
+			message << "'row_cols[k]' has to be smaller than 'n_cols' ('k' = " << k << ", 'row_cols[k]' = "
+			        << row_cols[k] << ", 'n_cols' = " << n_cols << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+		this->col_offsets[row_cols[k] +1]++;
+	}
+
+	for (unsigned c = 0; c < n_cols; c++)
+	{
+		this->cols_max_degree  = std::max(this->cols_max_degree, this->col_offsets[c +1]);
+		this->col_offsets[c +1] += this->col_offsets[c];
+	}
+
+	// counting sort of the connections by column (the rows are visited in order)
+	std::vector<unsigned> fill(this->col_offsets.begin(), this->col_offsets.end() -1);
+	for (unsigned r = 0; r < n_rows; r++)
+	{
+		this->rows_max_degree = std::max(this->rows_max_degree, row_offsets[r +1] - row_offsets[r]);
+		for (auto k = row_offsets[r]; k < row_offsets[r +1]; k++)
+			this->col_rows[fill[row_cols[k]]++] = r;
+	}
+}
+
+Sparse_matrix
+::Sparse_matrix(const Sparse_matrix &other)
+: flat(false)
+{
+	this->copy_flat(other);
+}
+
+Sparse_matrix
+::Sparse_matrix(Sparse_matrix &&other)
+: flat(false)
+{
+	*this = std::move(other);
 }
 
 Sparse_matrix
@@ -28,6 +123,114 @@ Sparse_matrix
 {
 }
 
+Sparse_matrix& Sparse_matrix
+::operator=(const Sparse_matrix &other)
+{
+	if (this != &other)
+		this->copy_flat(other);
+	return *this;
+}
+
+Sparse_matrix& Sparse_matrix
+::operator=(Sparse_matrix &&other)
+{
+	if (this != &other)
+	{
+		other.check_flat();
+
+		this->n_rows          = other.n_rows;
+		this->n_cols          = other.n_cols;
+		this->rows_max_degree = other.rows_max_degree;
+		this->cols_max_degree = other.cols_max_degree;
+		this->n_connections   = other.n_connections;
+
+		this->row_to_cols.clear();
+		this->col_to_rows.clear();
+		this->row_offsets = std::move(other.row_offsets);
+		this->row_cols    = std::move(other.row_cols   );
+		this->col_offsets = std::move(other.col_offsets);
+		this->col_rows    = std::move(other.col_rows   );
+		this->flat.store(true, std::memory_order_release);
+
+		// the moved matrix is left empty
+		other.n_rows = other.n_cols = other.rows_max_degree = other.cols_max_degree = other.n_connections = 0;
+		other.row_offsets.assign(1, 0);
+		other.col_offsets.assign(1, 0);
+		other.row_cols.clear();
+		other.col_rows.clear();
+	}
+	return *this;
+}
+
+void Sparse_matrix
+::copy_flat(const Sparse_matrix &other)
+{
+	other.check_flat();
+
+	this->n_rows          = other.n_rows;
+	this->n_cols          = other.n_cols;
+	this->rows_max_degree = other.rows_max_degree;
+	this->cols_max_degree = other.cols_max_degree;
+	this->n_connections   = other.n_connections;
+
+	this->row_to_cols.clear();
+	this->col_to_rows.clear();
+	this->row_offsets = other.row_offsets;
+	this->row_cols    = other.row_cols;
+	this->col_offsets = other.col_offsets;
+	this->col_rows    = other.col_rows;
+	this->flat.store(true, std::memory_order_release);
+}
+
+static void lists_to_flat(std::vector<std::vector<unsigned>> &lists, std::vector<unsigned> &offsets,
+                          std::vector<unsigned> &indexes)
+{
+	offsets.resize(lists.size() +1);
+	offsets[0] = 0;
+	for (size_t i = 0; i < lists.size(); i++)
+		offsets[i +1] = offsets[i] + (unsigned)lists[i].size();
+
+	indexes.resize(offsets.back());
+	for (size_t i = 0; i < lists.size(); i++)
+		std::copy(lists[i].begin(), lists[i].end(), indexes.begin() + offsets[i]);
+
+	std::vector<std::vector<unsigned>>().swap(lists);
+}
+
+static void flat_to_lists(std::vector<unsigned> &offsets, std::vector<unsigned> &indexes,
+                          std::vector<std::vector<unsigned>> &lists)
+{
+	lists.resize(offsets.size() -1);
+	for (size_t i = 0; i < lists.size(); i++)
+		lists[i].assign(indexes.begin() + offsets[i], indexes.begin() + offsets[i +1]);
+
+	std::vector<unsigned>().swap(offsets);
+	std::vector<unsigned>().swap(indexes);
+}
+
+void Sparse_matrix
+::make_flat() const
+{
+	std::lock_guard<std::mutex> lock(this->flat_lock);
+
+	if (this->flat.load(std::memory_order_relaxed))
+		return;
+
+	lists_to_flat(this->row_to_cols, this->row_offsets, this->row_cols);
+	lists_to_flat(this->col_to_rows, this->col_offsets, this->col_rows);
+
+	this->flat.store(true, std::memory_order_release);
+}
+
+void Sparse_matrix
+::make_lists()
+{
+	flat_to_lists(this->row_offsets, this->row_cols, this->row_to_cols);
+	flat_to_lists(this->col_offsets, this->col_rows, this->col_to_rows);
+
+	this->flat.store(false, std::memory_order_release);
+}
+
 unsigned Sparse_matrix
 ::get_n_rows() const
 {
@@ -58,42 +261,26 @@ unsigned Sparse_matrix
 	return this->n_connections;
 }
 
-const std::vector<unsigned>& Sparse_matrix
-::get_cols_from_row(const size_t row_index) const
-{
-	return this->row_to_cols[row_index];
-}
-
-const std::vector<unsigned>& Sparse_matrix
-::get_rows_from_col(const size_t col_index) const
-{
-	return this->col_to_rows[col_index];
-}
-
-const std::vector<unsigned>& Sparse_matrix
-::operator[](const size_t col_index) const
-{
-	return this->get_rows_from_col(col_index);
-}
-
 bool Sparse_matrix
 ::at(const size_t row_index, const size_t col_index) const
 {
-	auto it = std::find(this->row_to_cols[row_index].begin(), this->row_to_cols[row_index].end(), col_index);
+	const auto cols = this->get_cols_from_row(row_index);
 
-	return (it != this->row_to_cols[row_index].end());
+	return std::find(cols.begin(), cols.end(), col_index) != cols.end();
 }
 
-const std::vector<std::vector<unsigned int>>& Sparse_matrix
+Sparse_matrix::Span_list Sparse_matrix
 ::get_row_to_cols() const
 {
-	return this->row_to_cols;
+	this->check_flat();
+	return Span_list(this->row_offsets.data(), this->row_cols.data(), this->n_rows);
 }
 
-const std::vector<std::vector<unsigned int>>& Sparse_matrix
+Sparse_matrix::Span_list Sparse_matrix
 ::get_col_to_rows() const
 {
-	return this->col_to_rows;
+	this->check_flat();
+	return Span_list(this->col_offsets.data(), this->col_rows.data(), this->n_cols);
 }
 
 void Sparse_matrix
@@ -115,21 +302,30 @@ void Sparse_matrix
 		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	for (size_t i = 0; i < this->row_to_cols[row_index].size(); i++)
-		if (this->row_to_cols[row_index][i] == col_index)
-		{
-			std::stringstream message;
-			message << "'col_index' already exists ('col_index' = " << col_index << ").";
-			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	if (this->flat.load(std::memory_order_relaxed))
+		this->make_lists();
 
-	for (size_t i = 0; i < this->col_to_rows[col_index].size(); i++)
-		if (this->col_to_rows[col_index][i] == row_index)
-		{
-			std::stringstream message;
-			message << "'row_index' already exists ('row_index' = " << row_index << ").";
-			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-		}
+	// a connection is stored in both lists: searching the shortest one is enough
+	if (this->row_to_cols[row_index].size() <= this->col_to_rows[col_index].size())
+	{
+		for (size_t i = 0; i < this->row_to_cols[row_index].size(); i++)
+			if (this->row_to_cols[row_index][i] == col_index)
+			{
+				std::stringstream message;
+				message << "'col_index' already exists ('col_index' = " << col_index << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+	}
+	else
+	{
+		for (size_t i = 0; i < this->col_to_rows[col_index].size(); i++)
+			if (this->col_to_rows[col_index][i] == row_index)
+			{
+				std::stringstream message;
+				message << "'row_index' already exists ('row_index' = " << row_index << ").";
+				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+	}
 
 	this->row_to_cols[row_index].push_back((unsigned)col_index);
 	this->col_to_rows[col_index].push_back((unsigned)row_index);
@@ -156,6 +352,8 @@ void Sparse_matrix
 	std::swap(this->n_rows,          this->n_cols         );
 	std::swap(this->rows_max_degree, this->cols_max_degree);
 	std::swap(this->row_to_cols,     this->col_to_rows    );
+	std::swap(this->row_offsets,     this->col_offsets    );
+	std::swap(this->row_cols,        this->col_rows       );
 }
 
 float Sparse_matrix
@@ -1,14 +1,80 @@
 #ifndef SPARSE_MATRIX_HPP_
 #define SPARSE_MATRIX_HPP_
 
+#include <mutex>
+#include <atomic>
 #include <vector>
+#include <cstddef>
 
 namespace aff3ct
 {
 namespace tools
 {
+/*
+ * The connections are stored twice, in two flat arrays: by rows (CSR) and by columns (CSC). The matrix is built with
+ * 'add_connection' in per-row and per-column lists, the flat arrays are made at the first read access (the lists are
+ * then released).
+ */
 class Sparse_matrix
 {
+public:
+	/*
+	 * Read-only view on the indexes of a row (or of a column), valid until the next 'add_connection'
+	 */
+	class Span
+	{
+	private:
+		const unsigned *first;
+		size_t          n;
+
+	public:
+		Span(const unsigned *first = nullptr, const size_t n = 0) : first(first), n(n) {}
+
+		size_t          size      (                  ) const { return n;            }
+		bool            empty     (                  ) const { return n == 0;       }
+		const unsigned* data      (                  ) const { return first;        }
+		const unsigned* begin     (                  ) const { return first;        }
+		const unsigned* end       (                  ) const { return first + n;    }
+		const unsigned& front     (                  ) const { return first[0];     }
+		const unsigned& back      (                  ) const { return first[n -1];  }
+		const unsigned& operator[](const size_t i    ) const { return first[i];     }
+	};
+
+	/*
+	 * Read-only view on all the rows (or all the columns)
+	 */
+	class Span_list
+	{
+	private:
+		const unsigned *offsets;
+		const unsigned *indexes;
+		size_t          n;
+
+	public:
+		class iterator
+		{
+		private:
+			const unsigned *offsets;
+			const unsigned *indexes;
+
+		public:
+			iterator(const unsigned *offsets, const unsigned *indexes) : offsets(offsets), indexes(indexes) {}
+
+			Span      operator* (                    ) const { return Span(indexes + offsets[0], offsets[1] - offsets[0]); }
+			iterator& operator++(                    )       { offsets++; return *this;                                    }
+			bool      operator!=(const iterator &it  ) const { return offsets != it.offsets;                               }
+			bool      operator==(const iterator &it  ) const { return offsets == it.offsets;                               }
+		};
+
+		Span_list(const unsigned *offsets, const unsigned *indexes, const size_t n)
+		: offsets(offsets), indexes(indexes), n(n) {}
+
+		size_t   size      (              ) const { return n;                                                      }
+		Span     operator[](const size_t i) const { return Span(indexes + offsets[i], offsets[i +1] - offsets[i]); }
+		iterator begin     (              ) const { return iterator(offsets,     indexes);                         }
+		iterator end       (              ) const { return iterator(offsets + n, indexes);                         }
+	};
+
 private:
 	unsigned n_rows;
 	unsigned n_cols;
@@ -16,28 +82,59 @@ private:
 	unsigned cols_max_degree;
 	unsigned n_connections;
 
-	std::vector<std::vector<unsigned>> row_to_cols;
-	std::vector<std::vector<unsigned>> col_to_rows;
+	// per-row and per-column lists, only used during the building of the matrix
+	mutable std::vector<std::vector<unsigned>> row_to_cols;
+	mutable std::vector<std::vector<unsigned>> col_to_rows;
+
+	// flat arrays: the columns of the row 'r' are in 'row_cols[row_offsets[r]:row_offsets[r +1]]' (same for the rows
+	// of a column)
+	mutable std::vector<unsigned> row_offsets;
+	mutable std::vector<unsigned> row_cols;
+	mutable std::vector<unsigned> col_offsets;
+	mutable std::vector<unsigned> col_rows;
+
+	mutable std::atomic<bool> flat;      // true when the flat arrays are up to date
+	mutable std::mutex        flat_lock; // the flat arrays can be made by concurrent readers
 
 public:
 	Sparse_matrix(const unsigned n_rows = 0, const unsigned n_cols = 1);
+
+	/*
+	 * Build the matrix directly from its flat arrays (see above): 'row_offsets' has 'n_rows' +1 values, 'col_offsets'
+	 * has 'n_cols' +1 values and 'col_rows' has to be the transposition of 'row_cols' (the arrays are copied)
+	 */
+	Sparse_matrix(const unsigned n_rows, const unsigned n_cols,
+	              const unsigned *row_offsets, const unsigned *row_cols,
+	              const unsigned *col_offsets, const unsigned *col_rows);
+
+	/*
+	 * Build the matrix from the flat arrays of its rows only, the flat arrays of the columns are computed (the rows of
+	 * a column are sorted)
+	 */
+	Sparse_matrix(const unsigned n_rows, const unsigned n_cols,
+	              const unsigned *row_offsets, const unsigned *row_cols);
+	Sparse_matrix(const Sparse_matrix &other);
+	Sparse_matrix(Sparse_matrix &&other);
 	virtual ~Sparse_matrix();
 
+	Sparse_matrix& operator=(const Sparse_matrix &other);
+	Sparse_matrix& operator=(Sparse_matrix &&other);
+
 	unsigned get_n_rows         () const;
 	unsigned get_n_cols         () const;
 	unsigned get_rows_max_degree() const;
 	unsigned get_cols_max_degree() const;
 	unsigned get_n_connections  () const;
 
-	const std::vector<unsigned>& get_cols_from_row(const size_t row_index) const;
-	const std::vector<unsigned>& get_rows_from_col(const size_t col_index) const;
+	inline Span get_cols_from_row(const size_t row_index) const;
+	inline Span get_rows_from_col(const size_t col_index) const;
 
-	const std::vector<unsigned>& operator[](const size_t col_index) const;
+	inline Span operator[](const size_t col_index) const;
 
 	bool at(const size_t row_index, const size_t col_index) const;
 
-	const std::vector<std::vector<unsigned int>>& get_row_to_cols() const;
-	const std::vector<std::vector<unsigned int>>& get_col_to_rows() const;
+	Span_list get_row_to_cols() const;
+	Span_list get_col_to_rows() const;
 
 	void add_connection(const size_t row_index, const size_t col_index);
 
@@ -55,8 +152,17 @@ public:
 	 * Return the density of ones in this matrix
 	 */
 	float compute_density() const;
+
+private:
+	inline void check_flat() const;
+
+	void make_flat  () const;
+	void make_lists ();
+	void copy_flat  (const Sparse_matrix &other);
 };
 }
 }
 
+#include "Sparse_matrix.hxx"
+
 #endif /* SPARSE_MATRIX_HPP_ */
@@ -0,0 +1,36 @@
+#include "Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+void Sparse_matrix
+::check_flat() const
+{
+	if (!this->flat.load(std::memory_order_acquire))
+		this->make_flat();
+}
+
+Sparse_matrix::Span Sparse_matrix
+::get_cols_from_row(const size_t row_index) const
+{
+	this->check_flat();
+	return Span(this->row_cols.data() + this->row_offsets[row_index],
+	            this->row_offsets[row_index +1] - this->row_offsets[row_index]);
+}
+
+Sparse_matrix::Span Sparse_matrix
+::get_rows_from_col(const size_t col_index) const
+{
+	this->check_flat();
+	return Span(this->col_rows.data() + this->col_offsets[col_index],
+	            this->col_offsets[col_index +1] - this->col_offsets[col_index]);
+}
+
+Sparse_matrix::Span Sparse_matrix
+::operator[](const size_t col_index) const
+{
+	return this->get_rows_from_col(col_index);
+}
+}
+}
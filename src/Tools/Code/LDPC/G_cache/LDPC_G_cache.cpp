@@ -0,0 +1,155 @@
+#include <sstream>
+#include <iomanip>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Binary_file/Binary_file.hpp"
+
+#include "LDPC_G_cache.hpp"
+
+using namespace aff3ct::tools;
+
+static const std::string magic     = "AFF3CTG2";
+static const size_t      n_header  = 7; // number of 32-bit words of the header (hash of H and dimensions)
+static const uint64_t    fnv_basis = 0xcbf29ce484222325ULL;
+static const uint64_t    fnv_prime = 0x100000001b3ULL;
+
+static inline uint64_t fnv1a(uint64_t h, const uint32_t word)
+{
+	for (auto b = 0; b < 4; b++)
+		h = (h ^ (uint64_t)((word >> (8 * b)) & 0xFF)) * fnv_prime;
+	return h;
+}
+
+uint64_t LDPC_G_cache
+::hash(const Sparse_matrix &H)
+{
+	auto h = fnv_basis;
+	h = fnv1a(h, H.get_n_rows());
+	h = fnv1a(h, H.get_n_cols());
+
+	// the order of the connections matters: it drives the column swaps of the Gaussian elimination
+	for (const auto &cols : H.get_row_to_cols())
+	{
+		h = fnv1a(h, (uint32_t)cols.size());
+		for (auto c : cols)
+			h = fnv1a(h, c);
+	}
+
+	return h;
+}
+
+std::string LDPC_G_cache
+::path(const std::string &dir, const Sparse_matrix &H)
+{
+	std::stringstream p;
+	if (!dir.empty())
+		p << dir << (dir.back() == '/' ? "" : "/");
+	p << "G_" << H.get_n_rows() << "x" << H.get_n_cols() << "_"
+	  << std::hex << std::setw(16) << std::setfill('0') << hash(H) << ".gcache";
+	return p.str();
+}
+
+bool LDPC_G_cache
+::parse(const uint32_t *words, const size_t n_words, const Sparse_matrix &H, const int K, Sparse_matrix &G,
+        std::vector<unsigned> &info_bits_pos)
+{
+	if (n_words < n_header)
+		return false;
+
+	const auto h   = (uint64_t)words[0] | ((uint64_t)words[1] << 32);
+	const auto G_N = words[4], G_K = words[5], n_connections = words[6];
+	if (h != hash(H) || words[2] != H.get_n_rows() || words[3] != H.get_n_cols() || G_N != H.get_n_rows())
+		return false;
+
+	// a cache built for another number of information bits would make the decoders read out of their frames
+	if (K <= 0 || G_K != (uint32_t)K)
+		return false;
+	if (n_words != n_header + (size_t)G_K + (size_t)G_N + 1 + (size_t)n_connections)
+		return false;
+
+	const auto ibp     = words   + n_header;
+	const auto offsets = ibp     + G_K;
+	const auto cols    = offsets + G_N + 1;
+
+	if (offsets[0] != 0 || offsets[G_N] != n_connections)
+		return false;
+	for (unsigned i = 0; i < G_N; i++)
+		if (offsets[i] > offsets[i +1])
+			return false;
+	for (unsigned c = 0; c < n_connections; c++)
+		if (cols[c] >= G_K)
+			return false;
+
+	// the information bits are distinct positions in the codeword
+	std::vector<bool> is_info(G_N, false);
+	for (unsigned i = 0; i < G_K; i++)
+	{
+		if (ibp[i] >= G_N || is_info[ibp[i]])
+			return false;
+		is_info[ibp[i]] = true;
+	}
+
+	G = Sparse_matrix(G_N, G_K, offsets, cols);
+	info_bits_pos.assign(ibp, ibp + G_K);
+
+	return true;
+}
+
+bool LDPC_G_cache
+::load(const std::string &path, const Sparse_matrix &H, const int K, Sparse_matrix &G,
+       std::vector<unsigned> &info_bits_pos)
+{
+	if (!Binary_file::has_magic(path, magic))
+		return false;
+
+	try
+	{
+		const Binary_file file(path);
+
+		size_t n_words;
+		const auto words = file.get_words(magic, n_words);
+
+		return parse(words, n_words, H, K, G, info_bits_pos);
+	}
+	catch (std::exception const&)
+	{
+		// a corrupted file is treated as a cache miss
+		return false;
+	}
+}
+
+void LDPC_G_cache
+::save(const std::string &path, const Sparse_matrix &H, const Sparse_matrix &G,
+       const std::vector<unsigned> &info_bits_pos)
+{
+	if (info_bits_pos.size() != G.get_n_cols())
+	{
+		std::stringstream message;
+		message << "'info_bits_pos.size()' has to be equal to 'G.get_n_cols()' ('info_bits_pos.size()' = "
+		        << info_bits_pos.size() << ", 'G.get_n_cols()' = " << G.get_n_cols() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const uint64_t h = hash(H);
+
+	std::vector<uint32_t> words;
+	words.reserve(n_header + info_bits_pos.size() + G.get_n_rows() + 1 + G.get_n_connections());
+	words.push_back((uint32_t)(h >>  0));
+	words.push_back((uint32_t)(h >> 32));
+	words.push_back(H.get_n_rows());
+	words.push_back(H.get_n_cols());
+	words.push_back(G.get_n_rows());
+	words.push_back(G.get_n_cols());
+	words.push_back(G.get_n_connections());
+	words.insert(words.end(), info_bits_pos.begin(), info_bits_pos.end());
+
+	uint32_t off = 0;
+	words.push_back(off);
+	for (const auto &cols : G.get_row_to_cols())
+		words.push_back(off += (uint32_t)cols.size());
+	for (const auto &cols : G.get_row_to_cols())
+		words.insert(words.end(), cols.begin(), cols.end());
+
+	// written under a temporary name and renamed: concurrent runs never see a partially written cache
+	Binary_file::write(path, magic, words);
+}
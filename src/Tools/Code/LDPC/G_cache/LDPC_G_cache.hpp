@@ -0,0 +1,57 @@
+#ifndef LDPC_G_CACHE_HPP_
+#define LDPC_G_CACHE_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Binary cache of the G matrices (and of the information bits positions) derived from the H matrices.
+ * A cache file is keyed by a hash of H: the Gaussian elimination is skipped when a file matching H exists.
+ *
+ * File layout (a Binary_file with the "AFF3CTG2" magic, its 32-bit words are):
+ *   hash of H (low, high) | H rows | H cols | G rows (N) | G cols (K) | G connections |
+ *   info_bits_pos[K] | G row offsets[N +1] | G columns[connections]
+ */
+struct LDPC_G_cache
+{
+public:
+	/*
+	 * Return a 64-bit FNV-1a hash of the dimensions and of the connections of H.
+	 */
+	static uint64_t hash(const Sparse_matrix &H);
+
+	/*
+	 * Return the path of the cache file related to H in the 'dir' directory.
+	 */
+	static std::string path(const std::string &dir, const Sparse_matrix &H);
+
+	/*
+	 * Load G and the information bits positions from the 'path' cache file (mapped in memory in one go when the
+	 * platform supports it).
+	 * Return false if the file does not exist, if it is corrupted, if it has not been built from H, if it does not give
+	 * 'K' information bits or if its indexes are out of range (G and 'info_bits_pos' are then left unchanged).
+	 */
+	static bool load(const std::string &path, const Sparse_matrix &H, const int K, Sparse_matrix &G,
+	                 std::vector<unsigned> &info_bits_pos);
+
+	/*
+	 * Write G and the information bits positions in the 'path' cache file.
+	 */
+	static void save(const std::string &path, const Sparse_matrix &H, const Sparse_matrix &G,
+	                 const std::vector<unsigned> &info_bits_pos);
+
+private:
+	static bool parse(const uint32_t *words, const size_t n_words, const Sparse_matrix &H, const int K,
+	                  Sparse_matrix &G, std::vector<unsigned> &info_bits_pos);
+};
+}
+}
+
+#endif /* LDPC_G_CACHE_HPP_ */
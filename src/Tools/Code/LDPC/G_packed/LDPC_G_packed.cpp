@@ -0,0 +1,84 @@
+#include "LDPC_G_packed.hpp"
+
+using namespace aff3ct::tools;
+
+LDPC_G_packed
+::LDPC_G_packed(const Sparse_matrix &G)
+: N(G.get_n_rows()), K(G.get_n_cols()), n_words_K((G.get_n_cols() + 63) / 64)
+{
+	sparse_offset.push_back(0);
+	for (unsigned i = 0; i < this->N; i++)
+	{
+		const auto &cols = G.get_cols_from_row(i);
+
+		// a sparse row costs one XOR per one, a bit-packed row costs one AND and one XOR per word
+		if ((unsigned)cols.size() <= n_words_K)
+		{
+			sparse_rows.push_back(i);
+			sparse_cols.insert(sparse_cols.end(), cols.begin(), cols.end());
+			sparse_offset.push_back((unsigned)sparse_cols.size());
+		}
+		else
+		{
+			dense_rows.push_back(i);
+			dense_words.resize(dense_words.size() + n_words_K, 0);
+
+			const auto row = dense_words.data() + dense_words.size() - n_words_K;
+			for (auto c : cols)
+				row[c >> 6] |= (uint64_t)1 << (c & 63);
+		}
+	}
+}
+
+LDPC_G_packed
+::~LDPC_G_packed()
+{
+}
+
+unsigned LDPC_G_packed
+::get_N() const
+{
+	return this->N;
+}
+
+unsigned LDPC_G_packed
+::get_K() const
+{
+	return this->K;
+}
+
+unsigned LDPC_G_packed
+::get_n_words_K() const
+{
+	return this->n_words_K;
+}
+
+const std::vector<unsigned>& LDPC_G_packed
+::get_sparse_rows() const
+{
+	return this->sparse_rows;
+}
+
+const std::vector<unsigned>& LDPC_G_packed
+::get_sparse_offset() const
+{
+	return this->sparse_offset;
+}
+
+const std::vector<unsigned>& LDPC_G_packed
+::get_sparse_cols() const
+{
+	return this->sparse_cols;
+}
+
+const std::vector<unsigned>& LDPC_G_packed
+::get_dense_rows() const
+{
+	return this->dense_rows;
+}
+
+const std::vector<uint64_t>& LDPC_G_packed
+::get_dense_words() const
+{
+	return this->dense_words;
+}
@@ -0,0 +1,57 @@
+#ifndef LDPC_G_PACKED_HPP_
+#define LDPC_G_PACKED_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class LDPC_G_packed
+ *
+ * \brief Generator matrix in the layout of the XOR encoding (see module::Encoder_LDPC).
+ *
+ * The matrix is stored row by row (one row per codeword bit): the sparse rows by the positions of their ones and the
+ * other rows as bit-packed words. The object is immutable once built: it is built once per codec and shared by the
+ * encoders of all the threads.
+ */
+class LDPC_G_packed
+{
+private:
+	unsigned              N;             // number of rows (codeword bits)
+	unsigned              K;             // number of columns (information bits)
+	unsigned              n_words_K;     // number of 64-bit words in a bit-packed row
+	std::vector<unsigned> sparse_rows;   // codeword bits computed from the positions of the ones
+	std::vector<unsigned> sparse_offset; // offsets of the rows in 'sparse_cols' (size: sparse_rows.size() +1)
+	std::vector<unsigned> sparse_cols;   // positions of the ones in the sparse rows
+	std::vector<unsigned> dense_rows;    // codeword bits computed from the bit-packed rows
+	std::vector<uint64_t> dense_words;   // bit-packed rows ('n_words_K' words per row)
+
+public:
+	/*!
+	 * \brief Packs a generator matrix.
+	 *
+	 * \param G: the generator matrix, the rows are the codeword bits and the columns are the information bits.
+	 */
+	explicit LDPC_G_packed(const Sparse_matrix &G);
+
+	virtual ~LDPC_G_packed();
+
+	unsigned get_N        () const;
+	unsigned get_K        () const;
+	unsigned get_n_words_K() const;
+
+	const std::vector<unsigned>& get_sparse_rows  () const;
+	const std::vector<unsigned>& get_sparse_offset() const;
+	const std::vector<unsigned>& get_sparse_cols  () const;
+	const std::vector<unsigned>& get_dense_rows   () const;
+	const std::vector<uint64_t>& get_dense_words  () const;
+};
+}
+}
+
+#endif /* LDPC_G_PACKED_HPP_ */
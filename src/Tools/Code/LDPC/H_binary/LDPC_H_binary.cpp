@@ -0,0 +1,152 @@
+#include <vector>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Binary_file/Binary_file.hpp"
+
+#include "LDPC_H_binary.hpp"
+
+using namespace aff3ct::tools;
+
+static const std::string magic    = "AFF3CTH1";
+static const size_t      n_header = 4; // number of 32-bit words of the header (rows, cols, connections and K)
+
+bool LDPC_H_binary
+::is_binary(const std::string &path)
+{
+	return Binary_file::has_magic(path, magic);
+}
+
+Sparse_matrix LDPC_H_binary
+::parse(const uint32_t *words, const size_t n_words, const std::string &path, std::vector<unsigned> &info_bits_pos)
+{
+	if (n_words < n_header)
+	{
+		std::stringstream message;
+		message << "The '" << path << "' file is not in the binary format of the H matrices.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_rows = words[0], n_cols = words[1], n_connections = words[2], K = words[3];
+	const auto n_expected = n_header + ((size_t)n_rows +1) + ((size_t)n_cols +1) + 2 * (size_t)n_connections + K;
+	if (n_words != n_expected)
+	{
+		std::stringstream message;
+		message << "The size of the '" << path << "' file does not match its header ('n_rows' = " << n_rows
+		        << ", 'n_cols' = " << n_cols << ", 'n_connections' = " << n_connections << ", 'K' = " << K << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto row_offsets = words       + n_header;
+	const auto row_cols    = row_offsets + n_rows +1;
+	const auto col_offsets = row_cols    + n_connections;
+	const auto col_rows    = col_offsets + n_cols +1;
+	const auto ibp         = col_rows    + n_connections;
+
+	// the indexes are checked so a wrong file can't make the decoders read out of their arrays
+	auto is_valid = row_offsets[0] == 0 && row_offsets[n_rows] == n_connections &&
+	                col_offsets[0] == 0 && col_offsets[n_cols] == n_connections;
+	for (unsigned r = 0; is_valid && r < n_rows; r++) is_valid = row_offsets[r] <= row_offsets[r +1];
+	for (unsigned c = 0; is_valid && c < n_cols; c++) is_valid = col_offsets[c] <= col_offsets[c +1];
+	for (unsigned k = 0; is_valid && k < n_connections; k++) is_valid = row_cols[k] < n_cols && col_rows[k] < n_rows;
+	for (unsigned i = 0; is_valid && i < K;             i++) is_valid = ibp[i] < n_rows;
+	if (!is_valid)
+	{
+		std::stringstream message;
+		message << "The '" << path << "' file contains out of range offsets or indexes.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the columns (check nodes) have to be the transpose of the rows (variable nodes): the decoders use both views
+	if (!is_transpose(n_rows, n_cols, row_offsets, row_cols, col_offsets, col_rows))
+	{
+		std::stringstream message;
+		message << "The columns of the '" << path << "' file are not the transpose of its rows.";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	info_bits_pos.assign(ibp, ibp + K);
+	return Sparse_matrix(n_rows, n_cols, row_offsets, row_cols, col_offsets, col_rows);
+}
+
+bool LDPC_H_binary
+::is_transpose(const unsigned n_rows, const unsigned n_cols, const uint32_t *row_offsets, const uint32_t *row_cols,
+               const uint32_t *col_offsets, const uint32_t *col_rows)
+{
+	// the (row, col) connections of the rows are sorted by column (counting sort), so each column of the file can be
+	// compared to them: the rows of the column are stamped, then each connection of the rows to this column has to
+	// find (and clear) its stamp, the same number of connections on both sides makes the two lists equal
+	const auto n_connections = row_offsets[n_rows];
+
+	std::vector<uint32_t> by_col_offsets(n_cols +1, 0);
+	for (unsigned k = 0; k < n_connections; k++)
+		by_col_offsets[row_cols[k] +1]++;
+	for (unsigned c = 0; c < n_cols; c++)
+		by_col_offsets[c +1] += by_col_offsets[c];
+
+	std::vector<uint32_t> by_col_rows(n_connections);
+	std::vector<uint32_t> fill(by_col_offsets.begin(), by_col_offsets.end() -1);
+	for (unsigned r = 0; r < n_rows; r++)
+		for (auto k = row_offsets[r]; k < row_offsets[r +1]; k++)
+			by_col_rows[fill[row_cols[k]]++] = r;
+
+	std::vector<uint32_t> stamps(n_rows, 0);
+	for (unsigned c = 0; c < n_cols; c++)
+	{
+		if (col_offsets[c +1] - col_offsets[c] != by_col_offsets[c +1] - by_col_offsets[c])
+			return false;
+
+		for (auto k = col_offsets[c]; k < col_offsets[c +1]; k++)
+		{
+			if (stamps[col_rows[k]] == c +1) // twice the same row in the column
+				return false;
+			stamps[col_rows[k]] = c +1;
+		}
+
+		for (auto k = by_col_offsets[c]; k < by_col_offsets[c +1]; k++)
+		{
+			if (stamps[by_col_rows[k]] != c +1)
+				return false;
+			stamps[by_col_rows[k]] = 0;
+		}
+	}
+
+	return true;
+}
+
+Sparse_matrix LDPC_H_binary
+::read(const std::string &path, std::vector<unsigned> &info_bits_pos)
+{
+	const Binary_file file(path);
+
+	size_t n_words;
+	const auto words = file.get_words(magic, n_words);
+
+	return parse(words, n_words, path, info_bits_pos);
+}
+
+void LDPC_H_binary
+::write(const std::string &path, const Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos)
+{
+	std::vector<uint32_t> words;
+	words.reserve(n_header + H.get_n_rows() + H.get_n_cols() + 2 + 2 * H.get_n_connections() + info_bits_pos.size());
+
+	words.push_back(H.get_n_rows());
+	words.push_back(H.get_n_cols());
+	words.push_back(H.get_n_connections());
+	words.push_back((uint32_t)info_bits_pos.size());
+
+	for (const auto list : {H.get_row_to_cols(), H.get_col_to_rows()})
+	{
+		uint32_t off = 0;
+		words.push_back(off);
+		for (const auto &indexes : list)
+			words.push_back(off += (uint32_t)indexes.size());
+		for (const auto &indexes : list)
+			words.insert(words.end(), indexes.begin(), indexes.end());
+	}
+
+	words.insert(words.end(), info_bits_pos.begin(), info_bits_pos.end());
+
+	Binary_file::write(path, magic, words);
+}
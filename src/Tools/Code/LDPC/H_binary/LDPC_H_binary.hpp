@@ -0,0 +1,55 @@
+#ifndef LDPC_H_BINARY_HPP_
+#define LDPC_H_BINARY_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Binary format of the H matrices (and of the information bits positions): the flat arrays of the sparse matrix are
+ * stored as they are in memory, so the loading is a copy of the mapped file (no parsing and no 'add_connection').
+ *
+ * File layout (a Binary_file with the "AFF3CTH1" magic, its 32-bit words are):
+ *   rows | cols | connections | K |
+ *   row offsets[rows +1] | row columns[connections] | col offsets[cols +1] | col rows[connections] | info_bits_pos[K]
+ * K is 0 when the file does not give the information bits positions.
+ */
+struct LDPC_H_binary
+{
+public:
+	/*
+	 * Return true if the 'path' file is in the binary format (from its first bytes).
+	 */
+	static bool is_binary(const std::string &path);
+
+	/*
+	 * Read H and the information bits positions (empty if the file does not give them) from the 'path' binary file
+	 * (mapped in memory when the platform supports it).
+	 * Throw a runtime_error if the file is corrupted or if its rows and its columns do not give the same connections.
+	 */
+	static Sparse_matrix read(const std::string &path, std::vector<unsigned> &info_bits_pos);
+
+	/*
+	 * Write H and the information bits positions (can be empty) in the 'path' binary file.
+	 */
+	static void write(const std::string &path, const Sparse_matrix &H,
+	                  const std::vector<unsigned> &info_bits_pos = std::vector<unsigned>());
+
+private:
+	static Sparse_matrix parse(const uint32_t *words, const size_t n_words, const std::string &path,
+	                           std::vector<unsigned> &info_bits_pos);
+
+	// return true if the columns give the same connections as the rows (in any order inside a column)
+	static bool is_transpose(const unsigned n_rows, const unsigned n_cols, const uint32_t *row_offsets,
+	                         const uint32_t *row_cols, const uint32_t *col_offsets, const uint32_t *col_rows);
+};
+}
+}
+
+#endif /* LDPC_H_BINARY_HPP_ */
@@ -1,5 +1,6 @@
 #include <functional>
 #include <sstream>
+#include <thread>
 
 #include "Tools/Exception/exception.hpp"
 
@@ -7,6 +8,17 @@
 
 using namespace aff3ct::tools;
 
+// position of the least significant bit set in 'x' ('x' != 0), with a De Bruijn sequence
+static inline unsigned lsb_position(const uint64_t x)
+{
+	static const unsigned char debruijn_64[64] = { 0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+	                                              62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+	                                              63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+	                                              46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6};
+
+	return debruijn_64[((x & (~x +1)) * (uint64_t)0x03F79D71B4CB0A89) >> 58];
+}
+
 void LDPC_matrix_handler
 ::sparse_to_full(const Sparse_matrix& sparse, Full_matrix& full)
 {
@@ -32,18 +44,71 @@ Sparse_matrix LDPC_matrix_handler
 }
 
 Sparse_matrix LDPC_matrix_handler
-::transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos)
+::transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos, const int n_threads)
 {
-	LDPC_matrix_handler::Full_matrix mat;
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	LDPC_matrix_handler::Packed_matrix mat;
 
 	if (H.get_n_rows() > H.get_n_cols())
-		LDPC_matrix_handler::sparse_to_full(H.transpose(), mat);
+		LDPC_matrix_handler::sparse_to_packed(H.transpose(), mat);
 	else
-		LDPC_matrix_handler::sparse_to_full(H, mat);
+		LDPC_matrix_handler::sparse_to_packed(H, mat);
+
+	const auto n_col = H.get_n_rows() > H.get_n_cols() ? H.get_n_rows() : H.get_n_cols();
+
+	if (mat.size() > n_col)
+	{
+		std::stringstream message;
+		message << "'n_row' has to be smaller or equal to 'n_col' ('n_row' = " << mat.size()
+		        << ", 'n_col' = " << n_col << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<unsigned> swapped_cols;
+	LDPC_matrix_handler::create_diagonal(mat, n_col, swapped_cols, n_threads);
+	LDPC_matrix_handler::create_identity(mat, n_threads);
+
+	// the left part of the matrix is now the identity, G is made of the right part and of an identity below it
+	const auto n_row = (unsigned)mat.size();
 
-	LDPC_matrix_handler::transform_H_to_G(mat, info_bits_pos);
+	// Re-organization: get G
+	std::vector<unsigned> rows_order(n_col);
+	std::iota(rows_order.begin(), rows_order.end(), 0);
+	for (unsigned l = (unsigned)(swapped_cols.size() / 2); l > 0; l--)
+		std::swap(rows_order[swapped_cols[l*2-2]], rows_order[swapped_cols[l*2-1]]);
 
-	return LDPC_matrix_handler::full_to_sparse(mat);
+	Sparse_matrix G(n_col, n_col - n_row);
+	for (unsigned i = 0; i < n_col; i++)
+	{
+		const auto r = rows_order[i];
+		if (r < n_row)
+		{
+			for (auto j = n_row; j < n_col; j++)
+				if ((mat[r][j >> 6] >> (j & 63)) & 1)
+					G.add_connection(i, j - n_row);
+		}
+		else
+			G.add_connection(i, r - n_row);
+	}
+
+	// return info bits positions
+	info_bits_pos.resize(n_row);
+
+	std::vector<unsigned> bits_pos(n_col);
+	std::iota(bits_pos.begin(), bits_pos.begin() + n_col, 0);
+
+	for (unsigned l = 1; l <= (swapped_cols.size() / 2); l++)
+		std::swap(bits_pos[swapped_cols[l*2-2]], bits_pos[swapped_cols[l*2-1]]);
+
+	std::copy(bits_pos.begin() + (n_col-n_row), bits_pos.end(), info_bits_pos.begin());
+
+	return G;
 }
 
 void LDPC_matrix_handler
@@ -88,6 +153,260 @@ void LDPC_matrix_handler
 	std::copy(bits_pos.begin() + (n_col-n_row), bits_pos.end(), info_bits_pos.begin());
 }
 
+void LDPC_matrix_handler
+::sparse_to_packed(const Sparse_matrix& sparse, Packed_matrix& packed)
+{
+	const auto n_words = (sparse.get_n_cols() + 63) / 64;
+
+	packed.clear();
+	packed.resize(sparse.get_n_rows(), std::vector<uint64_t>(n_words, 0));
+
+	for (unsigned i = 0; i < sparse.get_n_rows(); i++)
+		for (auto j : sparse.get_cols_from_row(i))
+			packed[i][j >> 6] |= (uint64_t)1 << (j & 63);
+}
+
+void LDPC_matrix_handler
+::create_diagonal(Packed_matrix& mat, const unsigned n_col, std::vector<unsigned>& swapped_cols, const int n_threads)
+{
+	unsigned n_row = (unsigned)mat.size();
+	const auto n_words = (n_col + 63) / 64;
+
+	// 'masks[r]' gives the pivots of the current block which have not been applied yet on the row 'r' (except on the
+	// word of the current block which is always up to date)
+	std::vector<uint64_t> masks(n_row, 0);
+	std::vector<unsigned> pivots;
+
+	unsigned cur_w = 0;
+
+	auto flush_row = [&](const unsigned r)
+	{
+		for (auto m = masks[r]; m; m &= m -1)
+		{
+			const auto &pivot = mat[pivots[lsb_position(m)]];
+			for (auto w = cur_w +1; w < n_words; w++)
+				mat[r][w] ^= pivot[w];
+		}
+		masks[r] = 0;
+	};
+
+	auto flush_block = [&](const unsigned first_row)
+	{
+		if (!pivots.empty())
+			LDPC_matrix_handler::xor_pivots(mat, pivots, masks, first_row, n_row, cur_w +1, n_threads);
+		pivots.clear();
+	};
+
+	unsigned i = 0;
+	bool found = false;
+
+	while (i < n_row)
+	{
+		if ((i >> 6) != cur_w)
+		{
+			flush_block(i);
+			cur_w = i >> 6;
+		}
+
+		const auto w   = cur_w;
+		const auto bit = (uint64_t)1 << (i & 63);
+
+		if (mat[i][w] & bit)
+		{
+			flush_row(i);
+
+			pivots.push_back(i); // the pivots of a block are consecutive: 'pivots[b]' = 64 * 'cur_w' + 'b'
+
+			const auto pivot_w = mat[i][w];
+			for (unsigned j = i +1; j < n_row; j++)
+				if (mat[j][w] & bit)
+				{
+					mat[j][w] ^= pivot_w;
+					masks[j] |= bit;
+				}
+		}
+		else
+		{
+			for (unsigned j = i +1; j < n_row; j++) // find an other row which is good
+				if (mat[j][w] & bit)
+				{
+					std::swap(mat[i], mat[j]);
+					std::swap(masks[i], masks[j]);
+					i--;
+					found = true;
+					break;
+				}
+
+			if (!found) // if does not fund
+			{
+				flush_row(i);
+
+				// find an other column which is good
+				unsigned j = n_col;
+				for (auto ww = w; ww < n_words && j == n_col; ww++)
+				{
+					auto word = mat[i][ww];
+					if (ww == w) word &= ~((bit << 1) -1); // only the columns after 'i'
+					if (word)
+						j = ww * 64 + lsb_position(word);
+				}
+
+				if (j < n_col)
+				{
+					swapped_cols.push_back(i);
+					swapped_cols.push_back(j);
+
+					// the bits of the column 'j' are not up to date in the rows below, apply the pending pivots first
+					for (unsigned r = i +1; r < n_row; r++)
+						flush_row(r);
+
+					// swap the columns
+					const auto wi = i >> 6, wj = j >> 6;
+					const auto si = i & 63, sj = j & 63;
+					for (unsigned r = 0; r < n_row; r++)
+					{
+						const auto bi = (mat[r][wi] >> si) & 1;
+						const auto bj = (mat[r][wj] >> sj) & 1;
+						if (bi != bj)
+						{
+							mat[r][wi] ^= (uint64_t)1 << si;
+							mat[r][wj] ^= (uint64_t)1 << sj;
+						}
+					}
+
+					i--;
+					found = true;
+				}
+			}
+
+			if (!found) // if does not fund again this mean that the row is the null vector
+			{
+				mat  .erase(mat  .begin() +i);
+				masks.erase(masks.begin() +i);
+				i--;
+				n_row--;
+			}
+			found = false;
+		}
+		i++;
+	}
+
+	flush_block(n_row);
+}
+
+void LDPC_matrix_handler
+::create_identity(Packed_matrix& mat, const int n_threads)
+{
+	const auto n_row = (unsigned)mat.size();
+	if (n_row == 0)
+		return;
+
+	std::vector<uint64_t> masks(n_row, 0);
+	std::vector<unsigned> pivots;
+
+	const auto n_blocks = (n_row + 63) / 64;
+	for (auto b = n_blocks; b > 0; b--)
+	{
+		const auto w     = b -1;
+		const auto first = w * 64;
+		const auto last  = std::min(first + 64, n_row);
+
+		// reduce the pivots of the block between themselves
+		for (auto i = last -1; i > first; i--)
+			for (auto r = i; r > first; r--)
+				if ((mat[r-1][w] >> (i & 63)) & 1)
+					for (auto ww = w; ww < mat[r-1].size(); ww++)
+						mat[r-1][ww] ^= mat[i][ww];
+
+		// the columns of the pivots form an identity in the block: the bits of a row above are directly the pivots
+		// to apply
+		const auto pivots_mask = (last - first == 64) ? ~(uint64_t)0 : ((uint64_t)1 << (last - first)) -1;
+
+		pivots.resize(last - first);
+		std::iota(pivots.begin(), pivots.end(), first);
+		for (unsigned r = 0; r < first; r++)
+			masks[r] = mat[r][w] & pivots_mask;
+
+		LDPC_matrix_handler::xor_pivots(mat, pivots, masks, 0, first, w, n_threads);
+	}
+}
+
+void LDPC_matrix_handler
+::xor_pivots(Packed_matrix& mat, const std::vector<unsigned>& pivots, std::vector<uint64_t>& masks,
+             const unsigned first_row, const unsigned last_row, const unsigned first_word, const int n_threads)
+{
+	if (first_row >= last_row || mat.empty())
+		return;
+
+	const auto n_words = (unsigned)mat.front().size();
+	if (first_word >= n_words)
+	{
+		std::fill(masks.begin() + first_row, masks.begin() + last_row, (uint64_t)0);
+		return;
+	}
+
+	const auto n_groups = (unsigned)(pivots.size() + 7) / 8;
+	const auto length   = n_words - first_word;
+
+	// tables of the 256 combinations of 8 pivots
+	std::vector<uint64_t> tables(n_groups * 256 * length, 0);
+	for (unsigned g = 0; g < n_groups; g++)
+	{
+		auto table = tables.data() + g * 256 * length;
+		for (unsigned c = 1; c < 256; c++)
+		{
+			const auto low = lsb_position((uint64_t)c);
+			const auto p   = g * 8 + low;
+
+			const auto prev = table + (c & (c -1)) * length;
+			const auto cur  = table +  c           * length;
+			if (p < pivots.size())
+			{
+				const auto pivot = mat[pivots[p]].data() + first_word;
+				for (unsigned k = 0; k < length; k++)
+					cur[k] = prev[k] ^ pivot[k];
+			}
+			else
+				std::copy(prev, prev + length, cur);
+		}
+	}
+
+	auto update_rows = [&](const unsigned start, const unsigned stop)
+	{
+		for (auto r = start; r < stop; r++)
+		{
+			auto m = masks[r];
+			if (!m) continue;
+
+			auto row = mat[r].data() + first_word;
+			for (unsigned g = 0; g < n_groups; g++, m >>= 8)
+				if (m & 0xFF)
+				{
+					const auto comb = tables.data() + (g * 256 + (m & 0xFF)) * length;
+					for (unsigned k = 0; k < length; k++)
+						row[k] ^= comb[k];
+				}
+			masks[r] = 0;
+		}
+	};
+
+	const auto n_rows = last_row - first_row;
+	const auto n_thr  = (unsigned)std::max(1, std::min(n_threads, (int)(n_rows / 64)));
+	if (n_thr == 1)
+		update_rows(first_row, last_row);
+	else
+	{
+		std::vector<std::thread> threads(n_thr -1);
+		const auto chunk = (n_rows + n_thr -1) / n_thr;
+		for (unsigned t = 1; t < n_thr; t++)
+			threads[t -1] = std::thread(update_rows, std::min(last_row, first_row + t * chunk),
+			                                         std::min(last_row, first_row + (t +1) * chunk));
+		update_rows(first_row, std::min(last_row, first_row + chunk));
+		for (auto &t : threads)
+			t.join();
+	}
+}
+
 void LDPC_matrix_handler
 ::create_diagonal(Full_matrix& mat, std::vector<unsigned>& swapped_cols)
 {
@@ -249,3 +568,105 @@ std::vector<unsigned> LDPC_matrix_handler
 
 	return itl_vec;
 }
+
+std::vector<unsigned> LDPC_matrix_handler
+::reverse_cuthill_mckee(const Sparse_matrix& mat)
+{
+	const auto n_rows = mat.get_n_rows();
+
+	// degree of a row in the graph of the rows
+	std::vector<unsigned> degree(n_rows, 0);
+	for (unsigned r = 0; r < n_rows; r++)
+		for (auto c : mat.get_cols_from_row(r))
+			degree[r] += (unsigned)mat.get_rows_from_col(c).size() -1;
+
+	const auto by_degree = [&degree](const unsigned a, const unsigned b) { return degree[a] < degree[b]; };
+
+	// a new connected component starts from a row of minimum degree
+	std::vector<unsigned> seeds(n_rows);
+	std::iota(seeds.begin(), seeds.end(), 0);
+	std::stable_sort(seeds.begin(), seeds.end(), by_degree);
+
+	std::vector<bool> visited_row(n_rows, false), visited_col(mat.get_n_cols(), false);
+	std::vector<unsigned> order;
+	order.reserve(n_rows);
+
+	for (auto seed : seeds)
+	{
+		if (visited_row[seed])
+			continue;
+
+		visited_row[seed] = true;
+		order.push_back(seed);
+
+		// breadth-first search, the new neighbors of a row are visited by increasing degree
+		for (auto q = order.size() -1; q < order.size(); q++)
+		{
+			const auto first = order.size();
+			for (auto c : mat.get_cols_from_row(order[q]))
+			{
+				if (visited_col[c])
+					continue;
+				visited_col[c] = true; // all the rows of the column are visited now
+
+				for (auto r : mat.get_rows_from_col(c))
+					if (!visited_row[r])
+					{
+						visited_row[r] = true;
+						order.push_back(r);
+					}
+			}
+			std::stable_sort(order.begin() + first, order.end(), by_degree);
+		}
+	}
+
+	std::reverse(order.begin(), order.end());
+
+	return order;
+}
+
+Sparse_matrix LDPC_matrix_handler
+::reorder_rows(const Sparse_matrix& mat, const std::vector<unsigned>& old_rows_pos)
+{
+	if (mat.get_n_rows() != old_rows_pos.size())
+	{
+		std::stringstream message;
+		message << "'mat.get_n_rows()' has to be equal to 'old_rows_pos.size()' ('mat.get_n_rows()' = "
+		        << mat.get_n_rows() << ", 'old_rows_pos.size()' = " << old_rows_pos.size() << ").";
+		throw length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<unsigned> new_rows_pos(mat.get_n_rows(), mat.get_n_rows());
+	for (unsigned i = 0; i < old_rows_pos.size(); i++)
+		if (old_rows_pos[i] < mat.get_n_rows())
+			new_rows_pos[old_rows_pos[i]] = i;
+
+	for (unsigned r = 0; r < mat.get_n_rows(); r++)
+		if (new_rows_pos[r] == mat.get_n_rows())
+		{
+			std::stringstream message;
+			message << "'old_rows_pos' has to be a permutation of the rows ('missing row' = " << r << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	Sparse_matrix reordered(mat.get_n_rows(), mat.get_n_cols());
+	for (unsigned c = 0; c < mat.get_n_cols(); c++)
+		for (auto r : mat.get_rows_from_col(c))
+			reordered.add_connection(new_rows_pos[r], c);
+
+	return reordered;
+}
+
+std::vector<unsigned> LDPC_matrix_handler
+::reorder_positions(const std::vector<unsigned>& rows_pos, const std::vector<unsigned>& old_rows_pos)
+{
+	std::vector<unsigned> new_rows_pos(old_rows_pos.size());
+	for (unsigned i = 0; i < old_rows_pos.size(); i++)
+		new_rows_pos[old_rows_pos[i]] = i;
+
+	std::vector<unsigned> reordered(rows_pos.size());
+	for (size_t i = 0; i < rows_pos.size(); i++)
+		reordered[i] = new_rows_pos[rows_pos[i]];
+
+	return reordered;
+}
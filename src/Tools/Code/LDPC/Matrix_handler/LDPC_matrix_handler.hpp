@@ -3,6 +3,7 @@
 #define LDPC_MATRIX_HANDLER_HPP_
 
 #include <vector>
+#include <cstdint>
 #include <algorithm>
 #include <numeric>
 #include <mipp.h>
@@ -53,8 +54,10 @@ public:
 	 * Compute a G matrix related to the given H matrix.
 	 * Warning G is transposed !
 	 * Return also the information bits positions in the returned G matrix.
+	 * The Gaussian elimination works on bit-packed rows, the row updates can be spread over 'n_threads' threads.
 	 */
-	static Sparse_matrix transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos);
+	static Sparse_matrix transform_H_to_G(const Sparse_matrix& H, std::vector<unsigned>& info_bits_pos,
+	                                      const int n_threads = 1);
 
 	/*
 	 * integrate an interleaver inside the matrix to avoid this step.
@@ -72,10 +75,54 @@ public:
 	static std::vector<unsigned> interleave_info_bits_pos(const std::vector<unsigned>& info_bits_pos,
 	                                                      std::vector<unsigned>& old_cols_pos);
 
+	/*
+	 * Return the reverse Cuthill-McKee order of the rows of the matrix (the variable nodes of H): two rows are neighbors
+	 * when they share a column. The row old_rows_pos[i] of mat has to be set at position i: the rows connected to the
+	 * same columns end up close to each other.
+	 */
+	static std::vector<unsigned> reverse_cuthill_mckee(const Sparse_matrix& mat);
+
+	/*
+	 * Reorder the rows of the matrix: the row old_rows_pos[i] of mat is set at position i.
+	 * The order of the connections in each column is kept.
+	 */
+	static Sparse_matrix reorder_rows(const Sparse_matrix& mat, const std::vector<unsigned>& old_rows_pos);
+
+	/*
+	 * Return the positions after the reordering of the rows (see 'reorder_rows') of the given rows.
+	 */
+	static std::vector<unsigned> reorder_positions(const std::vector<unsigned>& rows_pos,
+	                                               const std::vector<unsigned>& old_rows_pos);
+
 protected :
+	// bit-packed rows: the column 'j' is the bit 'j % 64' of the word 'j / 64'
+	using Packed_matrix = std::vector<std::vector<uint64_t>>;
 
 	static void transform_H_to_G(Full_matrix& mat, std::vector<unsigned>& info_bits_pos);
 
+	static void sparse_to_packed(const Sparse_matrix& sparse, Packed_matrix& packed);
+
+	/*
+	 * Same as 'create_diagonal' (the same rows and columns are swapped) on a bit-packed matrix.
+	 * The rows below the current pivot are updated on the current word only, the other words are updated once per
+	 * block of 64 pivots.
+	 */
+	static void create_diagonal(Packed_matrix& mat, const unsigned n_col, std::vector<unsigned>& swapped_cols,
+	                            const int n_threads);
+
+	/*
+	 * Same as 'create_identity' on a bit-packed matrix, processed by blocks of 64 pivots.
+	 */
+	static void create_identity(Packed_matrix& mat, const int n_threads);
+
+	/*
+	 * XOR in each row 'r' of [first_row, last_row) the combination of the 'pivots' rows selected by 'masks[r]', on the
+	 * words from 'first_word' (Method of the Four Russians: tables of the 256 combinations of 8 pivots).
+	 */
+	static void xor_pivots(Packed_matrix& mat, const std::vector<unsigned>& pivots, std::vector<uint64_t>& masks,
+	                       const unsigned first_row, const unsigned last_row, const unsigned first_word,
+	                       const int n_threads);
+
 };
 }
 }
@@ -0,0 +1,251 @@
+#include <string>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "LDPC_QC.hpp"
+
+using namespace aff3ct::tools;
+
+static std::vector<std::string> split_line(const std::string &s)
+{
+	std::string buf;
+	std::stringstream ss(s);
+	std::vector<std::string> tokens;
+
+	while (ss >> buf)
+		tokens.push_back(buf);
+
+	return tokens;
+}
+
+static void read_line(std::istream &stream, std::string &line)
+{
+	if (stream.eof() || stream.fail() || stream.bad())
+		throw runtime_error(__FILE__, __LINE__, __func__, "Something went wrong when getting a new line.");
+
+	while (std::getline(stream, line))
+		if (line[0] != '#' && !std::all_of(line.begin(), line.end(), isspace))
+			break;
+}
+
+LDPC_QC
+::LDPC_QC(const unsigned Z, const unsigned n_block_rows, const unsigned n_block_cols)
+: Z(Z), n_block_rows(n_block_rows), n_block_cols(n_block_cols), shifts(n_block_rows * n_block_cols, -1)
+{
+	if (Z == 0)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'Z' has to be greater than 0.");
+}
+
+LDPC_QC
+::~LDPC_QC()
+{
+}
+
+unsigned LDPC_QC
+::get_Z() const
+{
+	return this->Z;
+}
+
+unsigned LDPC_QC
+::get_n_block_rows() const
+{
+	return this->n_block_rows;
+}
+
+unsigned LDPC_QC
+::get_n_block_cols() const
+{
+	return this->n_block_cols;
+}
+
+int LDPC_QC
+::get_shift(const unsigned block_row, const unsigned block_col) const
+{
+	return this->shifts[block_row * this->n_block_cols + block_col];
+}
+
+void LDPC_QC
+::set_shift(const unsigned block_row, const unsigned block_col, const int shift)
+{
+	if (block_row >= this->n_block_rows || block_col >= this->n_block_cols)
+	{
+		std::stringstream message;
+		message << "('block_row', 'block_col') is out of the base matrix ('block_row' = " << block_row
+		        << ", 'block_col' = " << block_col << ", 'n_block_rows' = " << this->n_block_rows
+		        << ", 'n_block_cols' = " << this->n_block_cols << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (shift < -1 || shift >= (int)this->Z)
+	{
+		std::stringstream message;
+		message << "'shift' has to be -1 or in [0, 'Z'[ ('shift' = " << shift << ", 'Z' = " << this->Z << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->shifts[block_row * this->n_block_cols + block_col] = shift;
+}
+
+Sparse_matrix LDPC_QC
+::expand() const
+{
+	Sparse_matrix H(this->n_block_cols * this->Z, this->n_block_rows * this->Z);
+
+	// check node by check node so the variable nodes of a check node are sorted
+	for (unsigned r = 0; r < this->n_block_rows; r++)
+		for (unsigned i = 0; i < this->Z; i++)
+			for (unsigned c = 0; c < this->n_block_cols; c++)
+			{
+				const auto shift = this->get_shift(r, c);
+				if (shift >= 0)
+					H.add_connection(c * this->Z + (i + shift) % this->Z, r * this->Z + i);
+			}
+
+	return H;
+}
+
+LDPC_QC LDPC_QC
+::read(std::istream &stream)
+{
+	std::string line;
+
+	read_line(stream, line);
+	auto values = split_line(line);
+	if (values.size() != 4 || values[0] != "QC")
+	{
+		std::stringstream message;
+		message << "The first line has to be \"QC n_block_rows n_block_cols Z\" ('line' = \"" << line << "\").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_block_rows = std::stoi(values[1]);
+	const auto n_block_cols = std::stoi(values[2]);
+	const auto Z            = std::stoi(values[3]);
+
+	if (n_block_rows <= 0 || n_block_cols <= 0 || Z <= 0)
+	{
+		std::stringstream message;
+		message << "'n_block_rows', 'n_block_cols' and 'Z' have to be greater than 0 ('n_block_rows' = "
+		        << n_block_rows << ", 'n_block_cols' = " << n_block_cols << ", 'Z' = " << Z << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	LDPC_QC base(Z, n_block_rows, n_block_cols);
+
+	for (auto r = 0; r < n_block_rows; r++)
+	{
+		read_line(stream, line);
+		values = split_line(line);
+
+		if ((int)values.size() != n_block_cols)
+		{
+			std::stringstream message;
+			message << "'values.size()' has to be equal to 'n_block_cols' ('values.size()' = " << values.size()
+			        << ", 'n_block_cols' = " << n_block_cols << ", 'r' = " << r << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		for (auto c = 0; c < n_block_cols; c++)
+			base.set_shift(r, c, std::stoi(values[c]));
+	}
+
+	return base;
+}
+
+void LDPC_QC
+::write(const LDPC_QC &base, std::ostream &stream)
+{
+	stream << "QC " << base.get_n_block_rows() << " " << base.get_n_block_cols() << " " << base.get_Z() << std::endl;
+
+	for (unsigned r = 0; r < base.get_n_block_rows(); r++)
+	{
+		for (unsigned c = 0; c < base.get_n_block_cols(); c++)
+			stream << base.get_shift(r, c) << " ";
+		stream << std::endl;
+	}
+}
+
+bool LDPC_QC
+::is_QC(std::istream &stream)
+{
+	const auto init_pos = stream.tellg();
+
+	std::string line;
+	while (std::getline(stream, line))
+		if (line[0] != '#' && !std::all_of(line.begin(), line.end(), isspace))
+			break;
+
+	const auto values = split_line(line);
+	const auto is_QC  = !values.empty() && values[0] == "QC";
+
+	stream.clear();
+	stream.seekg(init_pos);
+
+	return is_QC;
+}
+
+LDPC_QC LDPC_QC
+::detect(const Sparse_matrix &H)
+{
+	const auto N = H.get_n_rows();
+	const auto M = H.get_n_cols();
+
+	// the lifting size divides N and M, the largest one is tried first
+	auto gcd = N, b = M;
+	while (b)
+	{
+		const auto t = gcd % b;
+		gcd = b;
+		b   = t;
+	}
+
+	LDPC_QC base;
+	for (auto Z = gcd; Z > 1; Z--)
+		if (gcd % Z == 0 && LDPC_QC::match(H, Z, base))
+			return base;
+
+	throw invalid_argument(__FILE__, __LINE__, __func__, "The H matrix is not quasi-cyclic.");
+}
+
+bool LDPC_QC
+::match(const Sparse_matrix &H, const unsigned Z, LDPC_QC &base)
+{
+	const auto n_block_rows = H.get_n_cols() / Z;
+	const auto n_block_cols = H.get_n_rows() / Z;
+
+	base = LDPC_QC(Z, n_block_rows, n_block_cols);
+
+	// the first check node of each block row gives the shifts of its blocks
+	for (unsigned r = 0; r < n_block_rows; r++)
+		for (const auto v : H[r * Z])
+		{
+			const auto c = v / Z;
+			if (base.get_shift(r, c) >= 0)
+				return false; // two ones in the same row of a block
+			base.set_shift(r, c, v % Z);
+		}
+
+	// then each other check node of the block row has to be connected to the same blocks with the same shifts
+	for (unsigned m = 0; m < H.get_n_cols(); m++)
+	{
+		const auto r = m / Z;
+		const auto i = m % Z;
+		const auto VNs = H[m];
+
+		if (VNs.size() != H[r * Z].size())
+			return false;
+
+		for (const auto v : VNs)
+		{
+			const auto shift = base.get_shift(r, v / Z);
+			if (shift < 0 || (i + (unsigned)shift) % Z != v % Z)
+				return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,67 @@
+#ifndef LDPC_QC_HPP_
+#define LDPC_QC_HPP_
+
+#include <vector>
+#include <string>
+#include <iostream>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Base matrix of a quasi-cyclic H matrix: H is made of 'n_block_rows' x 'n_block_cols' square blocks of size Z (the
+ * lifting size), each block is the zero matrix (shift = -1) or the identity matrix cyclically shifted to the right by
+ * 'shift' positions (the check node 'r * Z + i' is connected to the variable node 'c * Z + (i + shift) % Z').
+ *
+ * File format (the lines starting with '#' are comments): "QC n_block_rows n_block_cols Z" on the first line (the "QC"
+ * token identifies the format), then one line of 'n_block_cols' shifts per block row.
+ */
+class LDPC_QC
+{
+private:
+	unsigned         Z;
+	unsigned         n_block_rows; // check    nodes blocks (= (N - K) / Z)
+	unsigned         n_block_cols; // variable nodes blocks (= N / Z)
+	std::vector<int> shifts;       // 'n_block_rows' x 'n_block_cols' shifts (-1 for the zero blocks)
+
+public:
+	LDPC_QC(const unsigned Z = 1, const unsigned n_block_rows = 0, const unsigned n_block_cols = 0);
+	virtual ~LDPC_QC();
+
+	unsigned get_Z           () const;
+	unsigned get_n_block_rows() const;
+	unsigned get_n_block_cols() const;
+
+	int  get_shift(const unsigned block_row, const unsigned block_col) const;
+	void set_shift(const unsigned block_row, const unsigned block_col, const int shift);
+
+	/*
+	 * Return the H matrix (rows = variable nodes, columns = check nodes, as the AList reader)
+	 */
+	Sparse_matrix expand() const;
+
+	static LDPC_QC read (                      std::istream &stream);
+	static void    write(const LDPC_QC &base, std::ostream &stream);
+
+	/*
+	 * Return true if the stream starts with the "QC" token of the base matrix format (the stream position is restored)
+	 */
+	static bool is_QC(std::istream &stream);
+
+	/*
+	 * Find the largest lifting size for which H is quasi-cyclic (each Z x Z block is zero or a single shifted
+	 * identity), throw if there is none (except Z = 1)
+	 */
+	static LDPC_QC detect(const Sparse_matrix &H);
+
+private:
+	// fill 'base' and return true when H is quasi-cyclic for the lifting size 'Z'
+	static bool match(const Sparse_matrix &H, const unsigned Z, LDPC_QC &base);
+};
+}
+}
+
+#endif /* LDPC_QC_HPP_ */
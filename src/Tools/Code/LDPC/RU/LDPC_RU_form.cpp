@@ -0,0 +1,353 @@
+#include <queue>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "LDPC_RU_form.hpp"
+
+using namespace aff3ct::tools;
+
+const unsigned LDPC_RU_form::max_n_left_checks = 1024;
+
+LDPC_RU_form
+::LDPC_RU_form()
+: valid(false), N(0), K(0), n_P_words(0)
+{
+}
+
+LDPC_RU_form
+::LDPC_RU_form(const Sparse_matrix &H, const int K)
+: valid(false), N(H.get_n_rows()), K(K), n_P_words(0)
+{
+	if (K <= 0 || K >= (int)this->N)
+	{
+		std::stringstream message;
+		message << "'K' has to be greater than 0 and smaller than 'N' ('K' = " << K << ", 'N' = " << this->N << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	std::vector<unsigned> free_bits, tri_checks, left_checks;
+	this->triangulate(H, free_bits, tri_checks, left_checks);
+
+	// the dense part of the encoding (and the elimination below) would cost more than a generator matrix
+	if (left_checks.size() > max_n_left_checks)
+		return;
+
+	this->compute_gap(free_bits);
+}
+
+LDPC_RU_form
+::~LDPC_RU_form()
+{
+}
+
+void LDPC_RU_form
+::triangulate(const Sparse_matrix &H, std::vector<unsigned> &free_bits, std::vector<unsigned> &tri_checks,
+              std::vector<unsigned> &left_checks)
+{
+	const auto M = H.get_n_cols();
+
+	// residual degree (number of unknown bits) and XOR of the indexes of the unknown bits of each check node: when the
+	// residual degree is 1, the XOR is the unknown bit
+	std::vector<unsigned> res_deg(M), xor_id(M, 0);
+	std::vector<bool>     is_known(N, false), is_used(M, false);
+
+	using deg_check = std::pair<unsigned,unsigned>;
+	std::priority_queue<deg_check, std::vector<deg_check>, std::greater<deg_check>> min_deg; // lazy deletion
+	std::vector<unsigned> deg1_checks;
+	size_t next_deg1 = 0;
+
+	for (unsigned c = 0; c < M; c++)
+	{
+		const auto &vars = H.get_rows_from_col(c);
+		res_deg[c] = (unsigned)vars.size();
+		for (auto v : vars)
+			xor_id[c] ^= v;
+
+		     if (res_deg[c] == 1) deg1_checks.push_back(c);
+		else if (res_deg[c] >  1) min_deg.push(std::make_pair(res_deg[c], c));
+	}
+
+	// unknown bits sorted by degree (lazy deletion)
+	unsigned max_deg = 0;
+	for (unsigned v = 0; v < N; v++)
+		max_deg = std::max(max_deg, (unsigned)H.get_cols_from_row(v).size());
+	std::vector<std::vector<unsigned>> by_deg(max_deg +1);
+	std::vector<size_t> next_by_deg(max_deg +1, 0);
+	for (unsigned v = 0; v < N; v++)
+		by_deg[H.get_cols_from_row(v).size()].push_back(v);
+
+	auto n_unknown = N;
+	auto set_known = [&](const unsigned v)
+	{
+		is_known[v] = true;
+		n_unknown--;
+		for (auto c : H.get_cols_from_row(v))
+		{
+			res_deg[c]--;
+			xor_id [c] ^= v;
+			if (!is_used[c])
+			{
+				     if (res_deg[c] == 1) deg1_checks.push_back(c);
+				else if (res_deg[c] >  1) min_deg.push(std::make_pair(res_deg[c], c));
+			}
+		}
+	};
+
+	free_bits .clear();
+	tri_checks.clear();
+	tri_bits  .clear();
+	while (n_unknown)
+	{
+		// back-substitution: a check node with one unknown bit solves it
+		while (next_deg1 < deg1_checks.size())
+		{
+			const auto c = deg1_checks[next_deg1++];
+			if (is_used[c] || res_deg[c] != 1)
+				continue;
+
+			is_used[c] = true;
+			tri_bits  .push_back(xor_id[c]);
+			tri_checks.push_back(c);
+			set_known(xor_id[c]);
+		}
+
+		if (!n_unknown)
+			break;
+
+		while (!min_deg.empty() && (is_used[min_deg.top().second] ||
+		                            res_deg[min_deg.top().second] != min_deg.top().first))
+			min_deg.pop();
+
+		// a bit of the check node of minimal residual degree becomes a free bit: the bit of highest degree, except if
+		// bits of higher degree remain elsewhere (the information bits of the dual-diagonal codes are freed before any
+		// parity bit, then the parity bits are all solved by the back-substitution)
+		auto v = N;
+		if (!min_deg.empty())
+		{
+			for (auto u : H.get_rows_from_col(min_deg.top().second))
+				if (!is_known[u] && (v == N || H.get_cols_from_row(u).size() > H.get_cols_from_row(v).size()))
+					v = u;
+		}
+
+		while (by_deg[max_deg].size() == next_by_deg[max_deg] || is_known[by_deg[max_deg][next_by_deg[max_deg]]])
+		{
+			if (by_deg[max_deg].size() == next_by_deg[max_deg])
+				max_deg--;
+			else
+				next_by_deg[max_deg]++;
+		}
+
+		if (v == N || H.get_cols_from_row(v).size() < max_deg)
+			v = by_deg[max_deg][next_by_deg[max_deg]];
+
+		free_bits.push_back(v);
+		set_known(v);
+	}
+
+	left_checks.clear();
+	for (unsigned c = 0; c < M; c++)
+		if (!is_used[c])
+			left_checks.push_back(c);
+
+	tri_offset.assign(1, 0);
+	tri_vars  .clear();
+	for (size_t t = 0; t < tri_bits.size(); t++)
+	{
+		for (auto v : H.get_rows_from_col(tri_checks[t]))
+			if (v != tri_bits[t])
+				tri_vars.push_back(v);
+		tri_offset.push_back((unsigned)tri_vars.size());
+	}
+
+	left_offset.assign(1, 0);
+	left_vars  .clear();
+	for (auto c : left_checks)
+	{
+		const auto &vars = H.get_rows_from_col(c);
+		left_vars.insert(left_vars.end(), vars.begin(), vars.end());
+		left_offset.push_back((unsigned)left_vars.size());
+	}
+}
+
+void LDPC_RU_form
+::compute_gap(const std::vector<unsigned> &free_bits)
+{
+	const auto F = (unsigned)free_bits.size();
+	const auto R = this->get_n_left_checks();
+
+	// A = [Phi | I]: Phi (R x F) gives the syndrome of the left check nodes from the free bits (with the triangular
+	// bits solved). The last freed bits come first: they are the best candidates to become gap bits.
+	const auto n_A_words = (F + R + 63) / 64;
+	std::vector<std::vector<uint64_t>> A(R, std::vector<uint64_t>(n_A_words, 0));
+
+	// adjoint of the back-substitution, for 64 left check nodes at a time
+	std::vector<uint64_t> adj(N);
+	for (unsigned r0 = 0; r0 < R; r0 += 64)
+	{
+		std::fill(adj.begin(), adj.end(), (uint64_t)0);
+
+		const auto r1 = std::min(r0 + 64, R);
+		for (auto r = r0; r < r1; r++)
+			for (auto i = left_offset[r]; i < left_offset[r +1]; i++)
+				adj[left_vars[i]] ^= (uint64_t)1 << (r - r0);
+
+		for (auto t = (int)tri_bits.size() -1; t >= 0; t--)
+		{
+			const auto a = adj[tri_bits[t]];
+			if (a)
+				for (auto i = tri_offset[t]; i < tri_offset[t +1]; i++)
+					adj[tri_vars[i]] ^= a;
+		}
+
+		for (unsigned j = 0; j < F; j++)
+		{
+			const auto a = adj[free_bits[F -1 -j]];
+			if (a)
+				for (auto r = r0; r < r1; r++)
+					if ((a >> (r - r0)) & 1)
+						A[r][j >> 6] |= (uint64_t)1 << (j & 63);
+		}
+	}
+	for (unsigned r = 0; r < R; r++)
+		A[r][(F + r) >> 6] |= (uint64_t)1 << ((F + r) & 63);
+
+	// Gauss-Jordan elimination on the Phi part: the pivot columns are the gap bits, the redundant left check nodes end
+	// up in null rows (they are verified whatever the information bits are)
+	std::vector<unsigned> gap_cols;
+	unsigned rank = 0;
+	for (unsigned j = 0; j < F && rank < R; j++)
+	{
+		const auto w = j >> 6;
+		const auto m = (uint64_t)1 << (j & 63);
+
+		auto p = rank;
+		while (p < R && !(A[p][w] & m))
+			p++;
+		if (p == R)
+			continue;
+
+		std::swap(A[p], A[rank]);
+		for (unsigned r = 0; r < R; r++)
+			if (r != rank && (A[r][w] & m))
+				for (auto k = w; k < n_A_words; k++)
+					A[r][k] ^= A[rank][k];
+
+		gap_cols.push_back(j);
+		rank++;
+	}
+
+	if (F - rank != K)
+		return;
+
+	// p1 = P * z, with P the rows of the pivots in the identity part of A
+	n_P_words = (R + 63) / 64;
+	P.assign(rank * n_P_words, 0);
+	gap_bits.clear();
+	for (unsigned k = 0; k < rank; k++)
+	{
+		gap_bits.push_back(free_bits[F -1 -gap_cols[k]]);
+		for (unsigned r = 0; r < R; r++)
+			if ((A[k][(F + r) >> 6] >> ((F + r) & 63)) & 1)
+				P[k * n_P_words + (r >> 6)] |= (uint64_t)1 << (r & 63);
+	}
+
+	std::vector<bool> is_gap(N, false);
+	for (auto v : gap_bits)
+		is_gap[v] = true;
+
+	info_bits_pos.clear();
+	for (auto v : free_bits)
+		if (!is_gap[v])
+			info_bits_pos.push_back(v);
+	std::sort(info_bits_pos.begin(), info_bits_pos.end());
+
+	valid = true;
+}
+
+bool LDPC_RU_form
+::is_valid() const
+{
+	return valid;
+}
+
+unsigned LDPC_RU_form
+::get_N() const
+{
+	return N;
+}
+
+unsigned LDPC_RU_form
+::get_K() const
+{
+	return K;
+}
+
+unsigned LDPC_RU_form
+::get_gap() const
+{
+	return (unsigned)gap_bits.size();
+}
+
+unsigned LDPC_RU_form
+::get_n_left_checks() const
+{
+	return left_offset.empty() ? 0 : (unsigned)left_offset.size() -1;
+}
+
+unsigned LDPC_RU_form
+::get_n_P_words() const
+{
+	return n_P_words;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_info_bits_pos() const
+{
+	return info_bits_pos;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_gap_bits() const
+{
+	return gap_bits;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_tri_bits() const
+{
+	return tri_bits;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_tri_offset() const
+{
+	return tri_offset;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_tri_vars() const
+{
+	return tri_vars;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_left_offset() const
+{
+	return left_offset;
+}
+
+const std::vector<unsigned>& LDPC_RU_form
+::get_left_vars() const
+{
+	return left_vars;
+}
+
+const std::vector<uint64_t>& LDPC_RU_form
+::get_P() const
+{
+	return P;
+}
@@ -0,0 +1,88 @@
+#ifndef LDPC_RU_FORM_HPP_
+#define LDPC_RU_FORM_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class LDPC_RU_form
+ *
+ * \brief Approximate lower triangular form of a parity-check matrix (Richardson-Urbanke), used to encode from H.
+ *
+ * The variable nodes are split in three sets: the information bits (s), the gap bits (p1) and the triangular bits
+ * (p2). Each triangular bit is solved by one check node from the bits that precede it (sparse back-substitution).
+ * The 'left' check nodes (not used to solve a triangular bit) form the gap: once the triangular bits are computed with
+ * p1 = 0, their syndrome 'z' gives p1 = P * z, where P is a small dense matrix, and the triangular bits are computed a
+ * second time. The gap is 0 for the dual-diagonal codes (IRA, DVB-S2) and small for the 802.16e/802.11n codes.
+ */
+class LDPC_RU_form
+{
+public:
+	static const unsigned max_n_left_checks; // above this number of left checks, H is considered as unstructured
+
+private:
+	bool     valid;
+	unsigned N;
+	unsigned K;
+
+	std::vector<unsigned> info_bits_pos; // positions of the information bits (sorted)
+	std::vector<unsigned> gap_bits;      // positions of the gap bits (p1)
+	std::vector<unsigned> tri_bits;      // positions of the triangular bits, in the solving order
+	std::vector<unsigned> tri_offset;    // offsets of the triangular bits in 'tri_vars' (size: tri_bits.size() +1)
+	std::vector<unsigned> tri_vars;      // other bits of the check node solving each triangular bit
+	std::vector<unsigned> left_offset;   // offsets of the left check nodes in 'left_vars'
+	std::vector<unsigned> left_vars;     // bits of the left check nodes
+	std::vector<uint64_t> P;             // bit-packed rows of P ('gap_bits.size()' rows of 'n_P_words' words)
+	unsigned              n_P_words;
+
+public:
+	/*!
+	 * \brief Builds an empty (invalid) form.
+	 */
+	LDPC_RU_form();
+
+	/*!
+	 * \brief Looks for an approximate lower triangular form of H (greedy triangulation).
+	 *
+	 * \param H: the parity-check matrix (the rows are the variable nodes and the columns are the check nodes).
+	 * \param K: the number of information bits.
+	 */
+	LDPC_RU_form(const Sparse_matrix &H, const int K);
+
+	virtual ~LDPC_RU_form();
+
+	/*!
+	 * \brief Returns true if an usable form has been found (K information bits and a gap small enough).
+	 */
+	bool is_valid() const;
+
+	unsigned get_N            () const;
+	unsigned get_K            () const;
+	unsigned get_gap          () const;
+	unsigned get_n_left_checks() const;
+	unsigned get_n_P_words    () const;
+
+	const std::vector<unsigned>& get_info_bits_pos() const;
+	const std::vector<unsigned>& get_gap_bits     () const;
+	const std::vector<unsigned>& get_tri_bits     () const;
+	const std::vector<unsigned>& get_tri_offset   () const;
+	const std::vector<unsigned>& get_tri_vars     () const;
+	const std::vector<unsigned>& get_left_offset  () const;
+	const std::vector<unsigned>& get_left_vars    () const;
+	const std::vector<uint64_t>& get_P            () const;
+
+private:
+	void triangulate(const Sparse_matrix &H, std::vector<unsigned> &free_bits, std::vector<unsigned> &tri_checks,
+	                 std::vector<unsigned> &left_checks);
+	void compute_gap(const std::vector<unsigned> &free_bits);
+};
+}
+}
+
+#endif /* LDPC_RU_FORM_HPP_ */
@@ -0,0 +1,188 @@
+#include <cmath>
+#include <bitset>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <mipp.h>
+
+#include "LDPC_syndrome.hpp"
+
+using namespace aff3ct::tools;
+
+// sign bits of 64 consecutive values (the bit 'i' is the sign of 'values[i]')
+template <typename R>
+inline uint64_t sign_bits_64_seq(const R *values)
+{
+	uint64_t bits = 0;
+	for (auto i = 0; i < 64; i++)
+		bits |= (uint64_t)std::signbit((float)values[i]) << i;
+	return bits;
+}
+
+#ifdef MIPP_NO_INTRINSICS
+template <typename R>
+inline uint64_t sign_bits_64(const R *values)
+{
+	return sign_bits_64_seq(values);
+}
+#else
+// integer type of the lanes of the mask of a register of 'R'
+template <typename R>
+using lane_int = typename std::conditional<sizeof(R) == 1, int8_t,
+                 typename std::conditional<sizeof(R) == 2, int16_t,
+                 typename std::conditional<sizeof(R) == 4, int32_t, int64_t>::type>::type>::type;
+
+// weight of the lane 'l' in 'msk_to_bits': its own bit 'l % g' (there are 'g' lanes in a 64-bit word)
+template <typename I>
+inline mipp::Reg<I> msk_weights()
+{
+	constexpr int g = 64 / (8 * sizeof(I));
+
+	I weights[mipp::N<I>()];
+	for (auto l = 0; l < mipp::N<I>(); l++)
+		weights[l] = (I)((uint64_t)1 << (l % g));
+
+	mipp::Reg<I> r_weights;
+	r_weights.loadu(weights);
+	return r_weights;
+}
+
+// packs a mask in a word (the bit 'l' is the lane 'l'): each lane keeps its weight, then the 64-bit words of the
+// register are folded with shifts so that their 'g' lanes end in their low bits (only MIPP operations: no movemask)
+template <typename I>
+inline uint64_t msk_to_bits(const mipp::Msk<mipp::N<I>()> &m)
+{
+	constexpr int w       = 8 * sizeof(I); // number of bits per lane
+	constexpr int g       = 64 / w;        // number of lanes per 64-bit word
+	constexpr int n_words = mipp::N<I>() / g;
+
+	static const auto r_weights = msk_weights<I>();
+
+	// the lane 'j' of a 64-bit word has its bit at the position 'j * w + j', folding by 'w' bits brings it to 'j'
+	auto r_bits = mipp::Reg<int64_t>((mipp::cvt_reg<I>(m) & r_weights).r);
+	for (auto s = 32; s >= w; s /= 2)
+		r_bits = r_bits | (r_bits >> s);
+
+	int64_t words[n_words];
+	r_bits.storeu(words);
+
+	uint64_t bits = 0;
+	for (auto k = 0; k < n_words; k++)
+		bits |= ((uint64_t)words[k] & (((uint64_t)1 << g) -1)) << (k * g);
+	return bits;
+}
+
+template <typename R>
+inline uint64_t sign_bits_64(const R *values)
+{
+	// the masks of the registers are packed side by side (a register has at most 64 lanes)
+	constexpr int n_lanes = mipp::N<R>();
+
+	uint64_t bits = 0;
+	for (auto i = 0; i < 64; i += n_lanes)
+	{
+		mipp::Reg<R> r_values;
+		r_values.loadu(values + i);
+		bits |= msk_to_bits<lane_int<R>>(mipp::sign(r_values)) << i;
+	}
+	return bits;
+}
+#endif
+
+LDPC_syndrome
+::LDPC_syndrome()
+: n_V_nodes(0), CN_offsets(1, 0)
+{
+}
+
+LDPC_syndrome
+::LDPC_syndrome(const Sparse_matrix &H)
+: n_V_nodes(H.get_n_rows()), CN_offsets(1, 0), hard_decisions((H.get_n_rows() + 63) / 64, 0)
+{
+	std::vector<std::pair<unsigned,uint64_t>> CN_words;
+	for (unsigned m = 0; m < H.get_n_cols(); m++)
+	{
+		// group the variable nodes of the check node by word
+		CN_words.clear();
+		for (const auto v : H[m])
+			CN_words.push_back(std::make_pair(v / 64, (uint64_t)1 << (v % 64)));
+		std::sort(CN_words.begin(), CN_words.end());
+
+		for (auto i = 0; i < (int)CN_words.size(); i++)
+			if (i == 0 || CN_words[i].first != CN_words[i -1].first)
+			{
+				this->words.push_back(CN_words[i].first);
+				this->masks.push_back(CN_words[i].second);
+			}
+			else
+				this->masks.back() |= CN_words[i].second;
+
+		this->CN_offsets.push_back((unsigned)this->words.size());
+	}
+}
+
+LDPC_syndrome
+::~LDPC_syndrome()
+{
+}
+
+template <typename R>
+bool LDPC_syndrome
+::check(const R *var_nodes)
+{
+	this->pack(var_nodes);
+	return this->check();
+}
+
+template <typename R>
+void LDPC_syndrome
+::pack(const R *var_nodes)
+{
+	const auto n_full_words = this->n_V_nodes / 64;
+
+	for (unsigned w = 0; w < n_full_words; w++)
+		this->hard_decisions[w] = sign_bits_64<R>(var_nodes + w * 64);
+
+	if (this->n_V_nodes % 64)
+	{
+		uint64_t bits = 0;
+		for (auto i = n_full_words * 64; i < this->n_V_nodes; i++)
+			bits |= (uint64_t)std::signbit((float)var_nodes[i]) << (i % 64);
+		this->hard_decisions[n_full_words] = bits;
+	}
+}
+
+bool LDPC_syndrome
+::check() const
+{
+	const auto n_C_nodes = (int)this->CN_offsets.size() -1;
+	for (auto m = 0; m < n_C_nodes; m++)
+	{
+		uint64_t acc = 0;
+		for (auto k = this->CN_offsets[m]; k < this->CN_offsets[m +1]; k++)
+			acc ^= this->hard_decisions[this->words[k]] & this->masks[k];
+
+		if (std::bitset<64>(acc).count() & 1)
+			return false;
+	}
+
+	return true;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef MULTI_PREC
+template bool aff3ct::tools::LDPC_syndrome::check<Q_8 >(const Q_8 *);
+template bool aff3ct::tools::LDPC_syndrome::check<Q_16>(const Q_16*);
+template bool aff3ct::tools::LDPC_syndrome::check<Q_32>(const Q_32*);
+template bool aff3ct::tools::LDPC_syndrome::check<Q_64>(const Q_64*);
+template void aff3ct::tools::LDPC_syndrome::pack <Q_8 >(const Q_8 *);
+template void aff3ct::tools::LDPC_syndrome::pack <Q_16>(const Q_16*);
+template void aff3ct::tools::LDPC_syndrome::pack <Q_32>(const Q_32*);
+template void aff3ct::tools::LDPC_syndrome::pack <Q_64>(const Q_64*);
+#else
+template bool aff3ct::tools::LDPC_syndrome::check<Q>(const Q*);
+template void aff3ct::tools::LDPC_syndrome::pack <Q>(const Q*);
+#endif
+// ==================================================================================== explicit template instantiation
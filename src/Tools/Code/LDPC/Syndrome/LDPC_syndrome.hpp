@@ -0,0 +1,58 @@
+#ifndef LDPC_SYNDROME_HPP_
+#define LDPC_SYNDROME_HPP_
+
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Syndrome of the hard decisions of a LDPC decoder: the sign bits of the a posteriori values are packed in 64-bit
+ * words (from the MIPP sign masks of the registers), then the parity of a check node is computed word by word: the
+ * words of the hard decisions which contain its variable nodes are masked, XORed together and the parity of the
+ * result is the parity of the check node. The check stops at the first check node which is not verified.
+ */
+class LDPC_syndrome
+{
+private:
+	unsigned n_V_nodes;
+
+	// the words of the check node 'm' are [CN_offsets[m], CN_offsets[m +1][
+	std::vector<unsigned> CN_offsets;
+	std::vector<unsigned> words;      // index of a word in 'hard_decisions'
+	std::vector<uint64_t> masks;      // variable nodes of the check node in this word
+
+	std::vector<uint64_t> hard_decisions; // packed sign bits of the variable nodes (1 for a negative value)
+
+public:
+	LDPC_syndrome();
+
+	/*
+	 * H: rows = variable nodes, columns = check nodes (in the order of the variable nodes of the decoder)
+	 */
+	explicit LDPC_syndrome(const Sparse_matrix &H);
+
+	virtual ~LDPC_syndrome();
+
+	/*
+	 * Return true when the hard decisions of the 'n_V_nodes' a posteriori values 'var_nodes' verify all the parity
+	 * checks
+	 */
+	template <typename R>
+	bool check(const R *var_nodes);
+
+	// pack the sign bits of the 'n_V_nodes' values 'var_nodes' in 'hard_decisions'
+	template <typename R>
+	void pack(const R *var_nodes);
+
+	// return true when the packed hard decisions verify all the parity checks
+	bool check() const;
+};
+}
+}
+
+#endif /* LDPC_SYNDROME_HPP_ */
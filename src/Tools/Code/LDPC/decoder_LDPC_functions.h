@@ -0,0 +1,40 @@
+#ifndef DECODER_LDPC_FUNCTIONS_H
+#define DECODER_LDPC_FUNCTIONS_H
+
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+// ------------------------------------------------------------------------------------------ SIMD tools of the BP
+
+// saturation of the messages (only the fixed-point messages are saturated)
+template <typename R>
+inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation);
+
+// additions and subtractions saturated to the range of the type in fixed-point (regular ones in floating-point)
+template <typename R>
+inline mipp::Reg<R> simd_adds(const mipp::Reg<R> val1, const mipp::Reg<R> val2);
+
+template <typename R>
+inline mipp::Reg<R> simd_subs(const mipp::Reg<R> val1, const mipp::Reg<R> val2);
+
+// normalization of the min-sum messages: 'F' / 8 is the normalization factor when 'F' > 0 (shifts and adds in
+// fixed-point, for the positive values only), 'factor' is used when 'F' = 0
+template <typename R, int F = 0>
+inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor);
+
+// tanh(val / 2), for the positive values 'val'
+template <typename R>
+inline mipp::Reg<R> simd_tanh_half(const mipp::Reg<R> val);
+
+// 2 atanh(val), for the values 'val' in [0,1[
+template <typename R>
+inline mipp::Reg<R> simd_2atanh(const mipp::Reg<R> val);
+}
+}
+
+#include "decoder_LDPC_functions.hxx"
+
+#endif /* DECODER_LDPC_FUNCTIONS_H */
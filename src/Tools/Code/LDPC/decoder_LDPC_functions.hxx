@@ -0,0 +1,98 @@
+#include "decoder_LDPC_functions.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+//                                                                                                           saturation
+template <typename R>
+inline mipp::Reg<R> simd_sat(const mipp::Reg<R> val, const R saturation)
+{
+	return val;
+}
+template <>
+inline mipp::Reg<short> simd_sat(const mipp::Reg<short> v, const short s)
+{
+	return mipp::sat(v, (short)-s, (short)+s);
+}
+template <>
+inline mipp::Reg<signed char> simd_sat(const mipp::Reg<signed char> v, const signed char s)
+{
+	return mipp::sat(v, (signed char)-s, (signed char)+s);
+}
+
+//                                                                                       saturated additions/subtractions
+template <typename R>
+inline mipp::Reg<R> simd_adds(const mipp::Reg<R> val1, const mipp::Reg<R> val2)
+{
+	return val1 + val2;
+}
+template <>
+inline mipp::Reg<short> simd_adds(const mipp::Reg<short> v1, const mipp::Reg<short> v2)
+{
+	return mipp::adds(v1, v2);
+}
+template <>
+inline mipp::Reg<signed char> simd_adds(const mipp::Reg<signed char> v1, const mipp::Reg<signed char> v2)
+{
+	return mipp::adds(v1, v2);
+}
+
+template <typename R>
+inline mipp::Reg<R> simd_subs(const mipp::Reg<R> val1, const mipp::Reg<R> val2)
+{
+	return val1 - val2;
+}
+template <>
+inline mipp::Reg<short> simd_subs(const mipp::Reg<short> v1, const mipp::Reg<short> v2)
+{
+	return mipp::subs(v1, v2);
+}
+template <>
+inline mipp::Reg<signed char> simd_subs(const mipp::Reg<signed char> v1, const mipp::Reg<signed char> v2)
+{
+	return mipp::subs(v1, v2);
+}
+
+//                                                                                                        normalization
+template <typename R, int F> inline mipp::Reg<R> simd_normalize(const mipp::Reg<R> val, const float factor)
+{
+	return val * mipp::Reg<R>((R)factor);
+}
+template <> inline mipp::Reg<short > simd_normalize<short, 1>(const mipp::Reg<short > v, const float f) { return (v >> 3);                       } // v * 0.125
+template <> inline mipp::Reg<short > simd_normalize<short, 2>(const mipp::Reg<short > v, const float f) { return            (v >> 2);            } // v * 0.250
+template <> inline mipp::Reg<short > simd_normalize<short, 3>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
+template <> inline mipp::Reg<short > simd_normalize<short, 4>(const mipp::Reg<short > v, const float f) { return                       (v >> 1); } // v * 0.500
+template <> inline mipp::Reg<short > simd_normalize<short, 5>(const mipp::Reg<short > v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
+template <> inline mipp::Reg<short > simd_normalize<short, 6>(const mipp::Reg<short > v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
+template <> inline mipp::Reg<short > simd_normalize<short, 7>(const mipp::Reg<short > v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
+template <> inline mipp::Reg<short > simd_normalize<short, 8>(const mipp::Reg<short > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,1>(const mipp::Reg<signed char> v, const float f) { return (v >> 3);                       } // v * 0.125
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,2>(const mipp::Reg<signed char> v, const float f) { return            (v >> 2);            } // v * 0.250
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,3>(const mipp::Reg<signed char> v, const float f) { return (v >> 3) + (v >> 2);            } // v * 0.375
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,4>(const mipp::Reg<signed char> v, const float f) { return                       (v >> 1); } // v * 0.500
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,5>(const mipp::Reg<signed char> v, const float f) { return (v >> 3) +            (v >> 1); } // v * 0.625
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,6>(const mipp::Reg<signed char> v, const float f) { return            (v >> 2) + (v >> 1); } // v * 0.750
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,7>(const mipp::Reg<signed char> v, const float f) { return (v >> 3) + (v >> 2) + (v >> 1); } // v * 0.825
+template <> inline mipp::Reg<signed char> simd_normalize<signed char,8>(const mipp::Reg<signed char> v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<float > simd_normalize<float, 8>(const mipp::Reg<float > v, const float f) { return v;                              } // v * 1.000
+template <> inline mipp::Reg<double> simd_normalize<double,8>(const mipp::Reg<double> v, const float f) { return v;                              } // v * 1.000
+
+//                                                                                                   hyperbolic tangent
+template <typename R>
+inline mipp::Reg<R> simd_tanh_half(const mipp::Reg<R> val)
+{
+	// tanh(x / 2) = 1 - 2 / (e^x + 1), e^x overflows to +inf for the large values and the result is then 1
+	const auto one = mipp::Reg<R>((R)1);
+	return one - mipp::Reg<R>((R)2) / (mipp::exp(val) + one);
+}
+
+template <typename R>
+inline mipp::Reg<R> simd_2atanh(const mipp::Reg<R> val)
+{
+	// 2 atanh(x) = log((1 + x) / (1 - x))
+	const auto one = mipp::Reg<R>((R)1);
+	return mipp::log((one + val) / (one - val));
+}
+}
+}
@@ -1,10 +1,17 @@
 #include <fstream>
+#include <iostream>
 #include <sstream>
 #include <numeric>
 #include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Display/bash_tools.h"
 #include "Tools/Code/LDPC/AList/AList.hpp"
+#include "Tools/Code/LDPC/H_binary/LDPC_H_binary.hpp"
+#include "Tools/Code/LDPC/G_cache/LDPC_G_cache.hpp"
+#include "Tools/Code/LDPC/RU/LDPC_RU_form.hpp"
+#include "Tools/Code/LDPC/QC/LDPC_QC.hpp"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
 
 #include "Tools/Factory/LDPC/Factory_encoder_LDPC.hpp"
 #include "Tools/Factory/LDPC/Factory_decoder_LDPC.hpp"
@@ -21,11 +28,13 @@ Codec_LDPC<B,Q>
   info_bits_pos(this->params.code.K),
   decoder_siso (params.simulation.n_threads, nullptr)
 {
+	Sparse_matrix G_sparse;
+
 	bool is_info_bits_pos = false;
 	if (!params.encoder.path.empty() && params.encoder.type == "LDPC")
 	{
 		std::ifstream file_G(params.encoder.path, std::ifstream::in);
-		G = AList::read(file_G);
+		G_sparse = AList::read(file_G);
 
 		try
 		{
@@ -40,21 +49,70 @@ Codec_LDPC<B,Q>
 		file_G.close();
 	}
 
+	// the H matrix is given in the binary format, by the base matrix of a quasi-cyclic code or in the AList format
+	std::vector<unsigned> H_info_bits_pos;
+	const auto is_H_binary = LDPC_H_binary::is_binary(params.code.alist_path);
+
 	std::ifstream file_H(params.code.alist_path, std::ifstream::in);
-	H = AList::read(file_H);
+	if (is_H_binary)
+		H = LDPC_H_binary::read(params.code.alist_path, H_info_bits_pos);
+	else if (LDPC_QC::is_QC(file_H))
+		H = LDPC_QC::read(file_H).expand();
+	else
+		H = AList::read(file_H);
 
-	if (!is_info_bits_pos)
+	if (params.encoder.type == "LDPC_RU")
 	{
-		try
+		ru = LDPC_RU_form(H, params.code.K);
+		if (ru.is_valid())
 		{
-			if (params.encoder.type == "LDPC_H")
+			// the systematic positions are fixed by the triangulation, they are not read from the H file
+			info_bits_pos    = ru.get_info_bits_pos();
+			is_info_bits_pos = true;
+		}
+		else
+			std::clog << format_warning("H has no usable approximate lower triangular form, the \"LDPC_RU\" encoder "
+			                            "falls back on a generator matrix.") << std::endl;
+	}
+
+	if (params.encoder.type == "LDPC_H" || (params.encoder.type == "LDPC_RU" && !ru.is_valid()))
+	{
+		// G is derived once and shared (read-only) by the encoders of all the threads, the Gaussian elimination is
+		// skipped when a cache file has already been built from the same H matrix
+		const auto cache_path = LDPC_G_cache::path(params.encoder.cache_path, H);
+		if (!LDPC_G_cache::load(cache_path, H, params.code.K, G_sparse, info_bits_pos))
+		{
+			G_sparse = LDPC_matrix_handler::transform_H_to_G(H, info_bits_pos, params.simulation.n_threads);
+
+			try
+			{
+				LDPC_G_cache::save(cache_path, H, G_sparse, info_bits_pos);
+			}
+			catch (std::exception const&)
 			{
-				auto encoder_LDPC = this->build_encoder();
-				encoder_LDPC->get_info_bits_pos(info_bits_pos);
-				delete encoder_LDPC;
+				// the cache is optional: when the directory is not writable G is simply derived again at the next run
 			}
-			else
-				info_bits_pos = AList::read_info_bits_pos(file_H, params.code.K, params.code.N);
+		}
+	}
+	else if (!is_info_bits_pos && is_H_binary)
+	{
+		if (H_info_bits_pos.empty()) // the binary file does not give the information bits positions
+			std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
+		else if (H_info_bits_pos.size() != info_bits_pos.size())
+		{
+			std::stringstream message;
+			message << "The '" << params.code.alist_path << "' binary file gives " << H_info_bits_pos.size()
+			        << " information bits positions instead of 'K' ('K' = " << params.code.K << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+		else
+			info_bits_pos = H_info_bits_pos;
+	}
+	else if (!is_info_bits_pos)
+	{
+		try
+		{
+			info_bits_pos = AList::read_info_bits_pos(file_H, params.code.K, params.code.N);
 		}
 		catch (std::exception const&)
 		{
@@ -63,6 +121,14 @@ Codec_LDPC<B,Q>
 	}
 
 	file_H.close();
+
+	// only the packed form of G is kept (the XOR encoding layout)
+	if (G_sparse.get_n_connections())
+		G = std::make_shared<const LDPC_G_packed>(G_sparse);
+
+	// conversion of the H matrix (and of the information bits positions) in the binary format
+	if (!params.code.bin_path.empty())
+		LDPC_H_binary::write(params.code.bin_path, H, info_bits_pos);
 }
 
 template <typename B, typename Q>
@@ -75,12 +141,17 @@ template <typename B, typename Q>
 Encoder_LDPC<B>* Codec_LDPC<B,Q>
 ::build_encoder(const int tid, const Interleaver<int>* itl)
 {
+	const auto is_H_derived = this->params.encoder.type == "LDPC_H" || this->params.encoder.type == "LDPC_RU";
+
 	return Factory_encoder_LDPC<B>::build(this->params.encoder.type,
 	                                      this->params.code.K,
 	                                      this->params.code.N_code,
 	                                      G,
 	                                      H,
-	                                      this->params.simulation.inter_frame_level);
+	                                      this->params.simulation.inter_frame_level,
+	                                      is_H_derived ? info_bits_pos : std::vector<unsigned>(),
+	                                      ru,
+	                                      this->params.encoder.type == "LDPC_DVBS2" ? this->params.encoder.path : "");
 }
 
 template <typename B, typename Q>
@@ -99,7 +170,13 @@ Decoder_SISO<B,Q>* Codec_LDPC<B,Q>
 	                                                     (Q)this->params.decoder.offset,
 	                                                     this->params.decoder.enable_syndrome,
 	                                                     this->params.decoder.syndrome_depth,
-	                                                     this->params.simulation.inter_frame_level);
+	                                                     this->params.simulation.inter_frame_level,
+	                                                     this->params.decoder.reorder,
+	                                                     this->params.decoder.n_bits_msg,
+	                                                     this->params.decoder.n_bits_app,
+	                                                     this->params.decoder.group_size,
+	                                                     this->params.decoder.compress,
+	                                                     this->params.decoder.n_threads);
 	return decoder_siso[tid];
 }
 
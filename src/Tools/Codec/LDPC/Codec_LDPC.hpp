@@ -1,12 +1,15 @@
 #ifndef CODEC_LDPC_HPP_
 #define CODEC_LDPC_HPP_
 
+#include <memory>
 #include <mipp.h>
 
 #include "Module/Decoder/Decoder_SISO.hpp"
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
 
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/RU/LDPC_RU_form.hpp"
+#include "Tools/Code/LDPC/G_packed/LDPC_G_packed.hpp"
 
 #include "../Codec_SISO.hpp"
 
@@ -19,9 +22,12 @@ class Codec_LDPC : public Codec_SISO<B,Q>
 {
 protected:
 	Sparse_matrix H;
-	Sparse_matrix G;
+	LDPC_RU_form  ru;
 	std::vector<unsigned> info_bits_pos;
 
+	// the generator matrix is packed once and shared (read-only) by the encoders of all the threads
+	std::shared_ptr<const LDPC_G_packed> G;
+
 	std::vector<module::Decoder_SISO<B,Q>*> decoder_siso;
 
 public:
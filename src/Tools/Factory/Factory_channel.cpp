@@ -4,6 +4,9 @@
 #include "Module/Channel/User/Channel_user.hpp"
 #include "Module/Channel/AWGN/Channel_AWGN_LLR.hpp"
 #include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR.hpp"
+#include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_Jakes.hpp"
+#include "Module/Channel/Binary/Channel_BSC.hpp"
+#include "Module/Channel/Binary/Channel_BEC.hpp"
 
 #include "Tools/Algo/Noise/Standard/Noise_std.hpp"
 #include "Tools/Algo/Noise/Fast/Noise_fast.hpp"
@@ -28,21 +31,28 @@ Channel<R>* Factory_channel<R>
         const std::string path,
         const int         seed,
         const R           sigma,
-        const int         n_frames)
+        const int         n_frames,
+        const R           doppler,
+        const int         n_sin,
+        const R           p)
 {
-	     if (type == "AWGN"         ) return new Channel_AWGN_LLR    <R>(N,          new tools::Noise_std <R>(seed), add_users, sigma, n_frames);
-	else if (type == "AWGN_FAST"    ) return new Channel_AWGN_LLR    <R>(N,          new tools::Noise_fast<R>(seed), add_users, sigma, n_frames);
-	else if (type == "RAYLEIGH"     ) return new Channel_Rayleigh_LLR<R>(N, complex, new tools::Noise_std <R>(seed), add_users, sigma, n_frames);
-	else if (type == "RAYLEIGH_FAST") return new Channel_Rayleigh_LLR<R>(N, complex, new tools::Noise_fast<R>(seed), add_users, sigma, n_frames);
-	else if (type == "USER"         ) return new Channel_user        <R>(N, path,                                    add_users,        n_frames);
-	else if (type == "NO"           ) return new Channel_NO          <R>(N,                                          add_users,        n_frames);
+	     if (type == "AWGN"               ) return new Channel_AWGN_LLR          <R>(N,          new tools::Noise_std <R>(seed),                      add_users, sigma, n_frames);
+	else if (type == "AWGN_FAST"          ) return new Channel_AWGN_LLR          <R>(N,          new tools::Noise_fast<R>(seed),                      add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH"           ) return new Channel_Rayleigh_LLR      <R>(N, complex, new tools::Noise_std <R>(seed),                      add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH_FAST"      ) return new Channel_Rayleigh_LLR      <R>(N, complex, new tools::Noise_fast<R>(seed),                      add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH_JAKES"     ) return new Channel_Rayleigh_LLR_Jakes<R>(N, complex, new tools::Noise_std <R>(seed), doppler, n_sin, seed, add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH_JAKES_FAST") return new Channel_Rayleigh_LLR_Jakes<R>(N, complex, new tools::Noise_fast<R>(seed), doppler, n_sin, seed, add_users, sigma, n_frames);
+	else if (type == "BSC"                ) return new Channel_BSC               <R>(N,                                                         seed,                 sigma, n_frames, p);
+	else if (type == "BEC"                ) return new Channel_BEC               <R>(N,                                                         seed,                 sigma, n_frames, p);
+	else if (type == "USER"               ) return new Channel_user              <R>(N, path,                                                         add_users,        n_frames);
+	else if (type == "NO"                 ) return new Channel_NO                <R>(N,                                                               add_users,        n_frames);
 #ifdef CHANNEL_MKL
-	else if (type == "AWGN_MKL"     ) return new Channel_AWGN_LLR    <R>(N,          new tools::Noise_MKL <R>(seed), add_users, sigma, n_frames);
-	else if (type == "RAYLEIGH_MKL" ) return new Channel_Rayleigh_LLR<R>(N, complex, new tools::Noise_MKL <R>(seed), add_users, sigma, n_frames);
+	else if (type == "AWGN_MKL"           ) return new Channel_AWGN_LLR          <R>(N,          new tools::Noise_MKL <R>(seed),                      add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH_MKL"       ) return new Channel_Rayleigh_LLR      <R>(N, complex, new tools::Noise_MKL <R>(seed),                      add_users, sigma, n_frames);
 #endif
 #ifdef CHANNEL_GSL
-	else if (type == "AWGN_GSL"     ) return new Channel_AWGN_LLR    <R>(N,          new tools::Noise_GSL <R>(seed), add_users, sigma, n_frames);
-	else if (type == "RAYLEIGH_GSL" ) return new Channel_Rayleigh_LLR<R>(N, complex, new tools::Noise_GSL <R>(seed), add_users, sigma, n_frames);
+	else if (type == "AWGN_GSL"           ) return new Channel_AWGN_LLR          <R>(N,          new tools::Noise_GSL <R>(seed),                      add_users, sigma, n_frames);
+	else if (type == "RAYLEIGH_GSL"       ) return new Channel_Rayleigh_LLR      <R>(N, complex, new tools::Noise_GSL <R>(seed),                      add_users, sigma, n_frames);
 #endif
 
 	throw cannot_allocate(__FILE__, __LINE__, __func__);
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "Module/Channel/Channel.hpp"
+#include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_Jakes.hpp"
 
 #include "Factory.hpp"
 
@@ -14,6 +15,8 @@ namespace tools
 template <typename R = float>
 struct Factory_channel : public Factory
 {
+	using Jakes = module::Channel_Rayleigh_LLR_Jakes<R>;
+
 	static module::Channel<R>* build(const std::string type,
 	                                 const int         N,
 	                                 const bool        complex,
@@ -21,7 +24,10 @@ struct Factory_channel : public Factory
 	                                 const std::string path      = "",
 	                                 const int         seed      = 0,
 	                                 const R           sigma     = (R)1,
-	                                 const int         n_frames  = 1);
+	                                 const int         n_frames  = 1,
+	                                 const R           doppler   = (R)Jakes::default_doppler,
+	                                 const int         n_sin     = Jakes::default_n_sin,
+	                                 const R           p         = (R)-1);
 };
 }
 }
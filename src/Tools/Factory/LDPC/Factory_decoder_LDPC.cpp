@@ -4,10 +4,20 @@
 #include "Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_log_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_offset_normalize_min_sum.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_LSPA_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_GALA_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp"
 #include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_intra.hpp"
+#include "Module/Decoder/LDPC/BP/Shuffled/SPA/Decoder_LDPC_BP_shuffled_sum_product.hpp"
+#include "Module/Decoder/LDPC/BP/Shuffled/LSPA/Decoder_LDPC_BP_shuffled_log_sum_product.hpp"
+#include "Module/Decoder/LDPC/BP/Shuffled/ONMS/Decoder_LDPC_BP_shuffled_offset_normalize_min_sum.hpp"
+#include "Module/Decoder/LDPC/BP/Residual/SPA/Decoder_LDPC_BP_residual_sum_product.hpp"
+#include "Module/Decoder/LDPC/BP/Residual/ONMS/Decoder_LDPC_BP_residual_offset_normalize_min_sum.hpp"
 
 #include "Factory_decoder_LDPC.hpp"
 
@@ -28,24 +38,52 @@ Decoder_SISO<B,R>* Factory_decoder_LDPC<B,R>
         const R                      offset,
         const bool                   synd,
         const int                    synd_depth,
-        const int                    n_frames)
+        const int                    n_frames,
+        const bool                   reorder,
+        const int                    n_bits_msg,
+        const int                    n_bits_app,
+        const int                    group_size,
+        const bool                   compress,
+        const int                    n_threads)
 {
 	if ((type == "BP" || type == "BP_FLOODING") && simd_strategy.empty())
 	{
-		     if (implem == "ONMS") return new Decoder_LDPC_BP_flooding_ONMS     <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames);
-		else if (implem == "GALA") return new Decoder_LDPC_BP_flooding_GALA     <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
-		else if (implem == "SPA" ) return new Decoder_LDPC_BP_flooding_SPA      <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
-		else if (implem == "LSPA") return new Decoder_LDPC_BP_flooding_LSPA     <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_flooding_ONMS      <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames);
+		else if (implem == "GALA") return new Decoder_LDPC_BP_flooding_GALA      <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+		else if (implem == "SPA" ) return new Decoder_LDPC_BP_flooding_SPA       <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+		else if (implem == "LSPA") return new Decoder_LDPC_BP_flooding_LSPA      <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+	}
+	else if ((type == "BP" || type == "BP_FLOODING") && simd_strategy == "INTER")
+	{
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_flooding_ONMS_inter<B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames);
+		else if (implem == "GALA") return new Decoder_LDPC_BP_flooding_GALA_inter<B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+		else if (implem == "SPA" ) return new Decoder_LDPC_BP_flooding_SPA_inter <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+		else if (implem == "LSPA") return new Decoder_LDPC_BP_flooding_LSPA_inter<B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
 	}
 	else if (type == "BP_LAYERED" && simd_strategy.empty())
 	{
-		     if (implem == "ONMS") return new Decoder_LDPC_BP_layered_ONMS      <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames);
-		else if (implem == "SPA" ) return new Decoder_LDPC_BP_layered_SPA       <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
-		else if (implem == "LSPA") return new Decoder_LDPC_BP_layered_LSPA      <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_layered_ONMS       <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames, reorder);
+		else if (implem == "SPA" ) return new Decoder_LDPC_BP_layered_SPA        <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames, reorder);
+		else if (implem == "LSPA") return new Decoder_LDPC_BP_layered_LSPA       <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames, reorder);
 	}
 	else if (type == "BP_LAYERED" && simd_strategy == "INTER")
 	{
-		     if (implem == "ONMS") return new Decoder_LDPC_BP_layered_ONMS_inter<B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames);
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_layered_ONMS_inter <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames, reorder, n_bits_msg, n_bits_app, compress);
+	}
+	else if (type == "BP_LAYERED" && simd_strategy == "INTRA")
+	{
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_layered_ONMS_intra <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames, n_threads);
+	}
+	else if (type == "BP_SHUFFLED" && simd_strategy.empty())
+	{
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_shuffled_ONMS      <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames, group_size, n_threads);
+		else if (implem == "SPA" ) return new Decoder_LDPC_BP_shuffled_SPA       <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames, group_size, n_threads);
+		else if (implem == "LSPA") return new Decoder_LDPC_BP_shuffled_LSPA      <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames, group_size, n_threads);
+	}
+	else if (type == "BP_RESIDUAL" && simd_strategy.empty())
+	{
+		     if (implem == "ONMS") return new Decoder_LDPC_BP_residual_ONMS      <B,R>(K, N, n_ite, H, info_bits_pos, factor, offset, synd, synd_depth, n_frames);
+		else if (implem == "SPA" ) return new Decoder_LDPC_BP_residual_SPA       <B,R>(K, N, n_ite, H, info_bits_pos,                 synd, synd_depth, n_frames);
 	}
 
 	throw cannot_allocate(__FILE__, __LINE__, __func__);
@@ -30,7 +30,13 @@ struct Factory_decoder_LDPC : public Factory
 	                                        const R                      offset        = 0,
 	                                        const bool                   synd          = true,
 	                                        const int                    synd_depth    = 2,
-	                                        const int                    n_frames      = 1);
+	                                        const int                    n_frames      = 1,
+	                                        const bool                   reorder       = false,
+	                                        const int                    n_bits_msg    = 0,
+	                                        const int                    n_bits_app    = 0,
+	                                        const int                    group_size    = 1,
+	                                        const bool                   compress      = false,
+	                                        const int                    n_threads     = 1);
 };
 }
 }
@@ -2,6 +2,7 @@
 
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
 #include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
+#include "Module/Encoder/LDPC/RU/Encoder_LDPC_RU.hpp"
 #include "Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2.hpp"
 
 #include "Factory_encoder_LDPC.hpp"
@@ -11,16 +12,28 @@ using namespace aff3ct::tools;
 
 template <typename B>
 Encoder_LDPC<B>* Factory_encoder_LDPC<B>
-::build(const std::string    type,
-        const int            K,
-        const int            N,
-        const Sparse_matrix &G,
-        const Sparse_matrix &H,
-        const int            n_frames)
+::build(const std::string                    type,
+        const int                            K,
+        const int                            N,
+        std::shared_ptr<const LDPC_G_packed> G,
+        const Sparse_matrix                 &H,
+        const int                            n_frames,
+        const std::vector<unsigned>         &info_bits_pos,
+        const LDPC_RU_form                  &ru,
+        const std::string                   &path)
 {
-	     if (type == "LDPC"      ) return new Encoder_LDPC       <B>(K, N, G, n_frames);
-	else if (type == "LDPC_H"    ) return new Encoder_LDPC_from_H<B>(K, N, H, n_frames);
-	else if (type == "LDPC_DVBS2") return new Encoder_LDPC_DVBS2 <B>(K, N,    n_frames);
+	// with "LDPC_H" and "LDPC_RU", a non-empty 'info_bits_pos' (or a valid 'ru' form) means that the caller has already
+	// derived G (or the form) from H. G is shared by the built encoders (not copied). With "LDPC_DVBS2", 'path' is an
+	// optional table of addresses.
+	const auto is_derived = !info_bits_pos.empty();
+
+	     if (type == "LDPC"                                    ) return new Encoder_LDPC       <B>(K, N, G, n_frames);
+	else if (type == "LDPC_H"  &&  is_derived                  ) return new Encoder_LDPC_from_H<B>(K, N, G, info_bits_pos, n_frames);
+	else if (type == "LDPC_H"                                  ) return new Encoder_LDPC_from_H<B>(K, N, H, n_frames);
+	else if (type == "LDPC_RU" && (is_derived || ru.is_valid())) return new Encoder_LDPC_RU    <B>(K, N, ru, G, info_bits_pos, n_frames);
+	else if (type == "LDPC_RU"                                 ) return new Encoder_LDPC_RU    <B>(K, N, H, n_frames);
+	else if (type == "LDPC_DVBS2" && !path.empty()             ) return new Encoder_LDPC_DVBS2 <B>(K, N, path, n_frames);
+	else if (type == "LDPC_DVBS2"                              ) return new Encoder_LDPC_DVBS2 <B>(K, N,    n_frames);
 
 	throw cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -2,7 +2,11 @@
 #define FACTORY_ENCODER_LDPC_HPP
 
 #include <string>
+#include <vector>
+#include <memory>
 #include "Tools/Algo/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/RU/LDPC_RU_form.hpp"
+#include "Tools/Code/LDPC/G_packed/LDPC_G_packed.hpp"
 
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
 
@@ -15,12 +19,15 @@ namespace tools
 template <typename B = int>
 struct Factory_encoder_LDPC : public Factory
 {
-	static module::Encoder_LDPC<B>* build(const std::string    type,
-	                                      const int            K,
-	                                      const int            N,
-	                                      const Sparse_matrix &G,
-	                                      const Sparse_matrix &H,
-	                                      const int            n_frames = 1);
+	static module::Encoder_LDPC<B>* build(const std::string                    type,
+	                                      const int                            K,
+	                                      const int                            N,
+	                                      std::shared_ptr<const LDPC_G_packed> G,
+	                                      const Sparse_matrix                 &H,
+	                                      const int                            n_frames      = 1,
+	                                      const std::vector<unsigned>         &info_bits_pos = std::vector<unsigned>(),
+	                                      const LDPC_RU_form                  &ru            = LDPC_RU_form(),
+	                                      const std::string                   &path          = "");
 };
 }
 }
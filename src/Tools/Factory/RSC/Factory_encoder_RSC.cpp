@@ -2,6 +2,7 @@
 
 #include "Module/Encoder/RSC/Encoder_RSC_generic_sys.hpp"
 #include "Module/Encoder/RSC/Encoder_RSC_generic_json_sys.hpp"
+#include "Module/Encoder/RSC/Encoder_RSC_table_sys.hpp"
 
 #include "Factory_encoder_RSC.hpp"
 
@@ -19,7 +20,12 @@ Encoder_RSC_sys<B>* Factory_encoder_RSC<B>
         const int               n_frames)
 {
 	     if (type == "RSC_JSON") return new Encoder_RSC_generic_json_sys<B>(K, N, buffered, poly, stream, n_frames);
-	else if (type == "RSC"     ) return new Encoder_RSC_generic_sys     <B>(K, N, buffered, poly,         n_frames);
+	else if (type == "RSC"     )
+	{
+		// the trellis of the polynomials, encoded 8 bits at a time
+		const auto trellis = Encoder_RSC_generic_sys<B>(K, N, buffered, poly).get_trellis();
+		return new Encoder_RSC_table_sys<B>(K, N, trellis, buffered, n_frames);
+	}
 
 	throw cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -8,6 +8,7 @@
 #ifndef REORDERER_HPP_
 #define REORDERER_HPP_
 
+#include <array>
 #include <vector>
 #include <mipp.h>
 
@@ -34,7 +35,17 @@ public:
 	 * \param out_data:    the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
 	 * \param data_length: the size of one frame.
 	 */
-	static void apply(const std::vector<const T*> in_data, T* out_data, const int data_length);
+	static void apply(const std::vector<const T*> &in_data, T* out_data, const int data_length);
+
+	/*!
+	 * \brief Applies the reordering from an array of frames (no allocation).
+	 *
+	 * \param in_data:     an array of "n_frames" frames (all the frames have to have the same size).
+	 * \param out_data:    the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
+	 * \param n_frames:    the number of frames.
+	 * \param data_length: the size of one frame.
+	 */
+	static void apply(const T* const* in_data, T* out_data, const int n_frames, const int data_length);
 
 	/*!
 	 * \brief Reverses the reordering.
@@ -44,7 +55,17 @@ public:
 	 * \param out_data:    a vector of frames.
 	 * \param data_length: the size of one frame.
 	 */
-	static void apply_rev(const T* in_data, std::vector<T*> out_data, const int data_length);
+	static void apply_rev(const T* in_data, const std::vector<T*> &out_data, const int data_length);
+
+	/*!
+	 * \brief Reverses the reordering to an array of frames (no allocation).
+	 *
+	 * \param in_data:     the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
+	 * \param out_data:    an array of "n_frames" frames.
+	 * \param n_frames:    the number of frames.
+	 * \param data_length: the size of one frame.
+	 */
+	static void apply_rev(const T* in_data, T* const* out_data, const int n_frames, const int data_length);
 };
 
 /*!
@@ -67,7 +88,25 @@ public:
 	 * \param out_data:    the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
 	 * \param data_length: the size of one frame.
 	 */
-	static void apply(const std::vector<const T*> in_data, T* out_data, const int data_length);
+	static void apply(const std::vector<const T*> &in_data, T* out_data, const int data_length);
+
+	/*!
+	 * \brief Applies the reordering from an array of frames (no allocation, the array can be on the stack).
+	 *
+	 * \param in_data:     the N_FRAMES frames (all the frames have to have the same size).
+	 * \param out_data:    the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
+	 * \param data_length: the size of one frame.
+	 */
+	static void apply(const std::array<const T*,N_FRAMES> &in_data, T* out_data, const int data_length);
+
+	/*!
+	 * \brief Applies the reordering from a pointer to N_FRAMES frames (no allocation).
+	 *
+	 * \param in_data:     the N_FRAMES frames (all the frames have to have the same size).
+	 * \param out_data:    the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
+	 * \param data_length: the size of one frame.
+	 */
+	static void apply(const T* const* in_data, T* out_data, const int data_length);
 
 	/*!
 	 * \brief Reverses the reordering.
@@ -77,7 +116,25 @@ public:
 	 * \param out_data:    a vector of frames.
 	 * \param data_length: the size of one frame.
 	 */
-	static void apply_rev(const T* in_data, std::vector<T*> out_data, const int data_length);
+	static void apply_rev(const T* in_data, const std::vector<T*> &out_data, const int data_length);
+
+	/*!
+	 * \brief Reverses the reordering to an array of frames (no allocation, the array can be on the stack).
+	 *
+	 * \param in_data:     the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
+	 * \param out_data:    the N_FRAMES frames.
+	 * \param data_length: the size of one frame.
+	 */
+	static void apply_rev(const T* in_data, const std::array<T*,N_FRAMES> &out_data, const int data_length);
+
+	/*!
+	 * \brief Reverses the reordering to a pointer to N_FRAMES frames (no allocation).
+	 *
+	 * \param in_data:     the reordered frames (interleaved regularly | e0_f0| e0_f1 | e0_f2 | e0_f3 | e1_f0 |...).
+	 * \param out_data:    the N_FRAMES frames.
+	 * \param data_length: the size of one frame.
+	 */
+	static void apply_rev(const T* in_data, T* const* out_data, const int data_length);
 };
 }
 }
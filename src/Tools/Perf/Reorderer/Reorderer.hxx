@@ -3,6 +3,7 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Math/utils.h"
+#include "Tools/Perf/Transpose/transpose_selector.h"
 
 #include "Reorderer.hpp"
 
@@ -16,14 +17,23 @@ namespace tools
 {
 template <typename T>
 void Reorderer<T>
-::apply(const std::vector<const T*> in_data, T* out_data, const int data_length)
+::apply(const std::vector<const T*> &in_data, T* out_data, const int data_length)
 {
-	const int n_fra   = (int)in_data.size();
+	Reorderer<T>::apply(in_data.data(), out_data, (int)in_data.size(), data_length);
+}
+
+template <typename T>
+void Reorderer<T>
+::apply(const T* const* in_data, T* out_data, const int n_frames, const int data_length)
+{
+	const int n_fra   = n_frames;
 	const int n_fra_2 = n_fra / 2;
 
-	int start_seq_loop = 0;
+	// specialized transposition (one frame per element of a register)
+	int start_seq_loop = frames_transpose(reinterpret_cast<const void* const*>(in_data), (void*)out_data, n_fra,
+	                                      data_length, (int)sizeof(T));
 
-	if (is_power_of_2((int)in_data.size()) && (int)in_data.size() >= 2 && (int)in_data.size() <= mipp::nElReg<T>())
+	if (start_seq_loop == 0 && is_power_of_2(n_fra) && n_fra >= 2 && n_fra <= mipp::nElReg<T>())
 	{
 		mipp::reg regs_inter[mipp::nElReg<T>()];
 
@@ -135,7 +145,7 @@ struct Reorderer_static_core <T,N_FRAMES,J,16384>
 
 template <typename T, int N_FRAMES>
 void Reorderer_static<T,N_FRAMES>
-::apply(const std::vector<const T*> in_data, T* out_data, const int data_length)
+::apply(const std::vector<const T*> &in_data, T* out_data, const int data_length)
 {
 	if (in_data.size() != N_FRAMES)
 	{
@@ -145,11 +155,27 @@ void Reorderer_static<T,N_FRAMES>
 		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	Reorderer_static<T,N_FRAMES>::apply(in_data.data(), out_data, data_length);
+}
+
+template <typename T, int N_FRAMES>
+void Reorderer_static<T,N_FRAMES>
+::apply(const std::array<const T*,N_FRAMES> &in_data, T* out_data, const int data_length)
+{
+	Reorderer_static<T,N_FRAMES>::apply(in_data.data(), out_data, data_length);
+}
+
+template <typename T, int N_FRAMES>
+void Reorderer_static<T,N_FRAMES>
+::apply(const T* const* in_data, T* out_data, const int data_length)
+{
 	constexpr int n_fra = N_FRAMES;
 
-	int start_seq_loop = 0;
+	// specialized transposition (one frame per element of a register)
+	int start_seq_loop = frames_transpose(reinterpret_cast<const void* const*>(in_data), (void*)out_data, n_fra,
+	                                      data_length, (int)sizeof(T));
 
-	if (is_power_of_2((int)in_data.size()) && (int)in_data.size() >= 2 && (int)in_data.size() <= mipp::nElReg<T>())
+	if (start_seq_loop == 0 && is_power_of_2(n_fra) && n_fra >= 2 && n_fra <= mipp::nElReg<T>())
 	{
 #ifndef _MSC_VER
 		mipp::reg regs_inter[n_fra];
@@ -197,14 +223,23 @@ void Reorderer_static<T,N_FRAMES>
 
 template <typename T>
 void Reorderer<T>
-::apply_rev(const T* in_data, std::vector<T*> out_data, const int data_length)
+::apply_rev(const T* in_data, const std::vector<T*> &out_data, const int data_length)
 {
-	const int n_fra   = (int)out_data.size();
+	Reorderer<T>::apply_rev(in_data, out_data.data(), (int)out_data.size(), data_length);
+}
+
+template <typename T>
+void Reorderer<T>
+::apply_rev(const T* in_data, T* const* out_data, const int n_frames, const int data_length)
+{
+	const int n_fra   = n_frames;
 	const int n_fra_2 = n_fra / 2;
 
-	int start_seq_loop = 0;
+	// specialized transposition (one frame per element of a register)
+	int start_seq_loop = frames_itranspose((const void*)in_data, reinterpret_cast<void* const*>(out_data), n_fra,
+	                                       data_length, (int)sizeof(T));
 
-	if (is_power_of_2((int)out_data.size()) && (int)out_data.size() >= 2 && (int)out_data.size() <= mipp::nElReg<T>())
+	if (start_seq_loop == 0 && is_power_of_2(n_fra) && n_fra >= 2 && n_fra <= mipp::nElReg<T>())
 	{
 		mipp::reg regs_inter[mipp::nElReg<T>()];
 
@@ -369,7 +404,7 @@ struct Reorderer_static_core_rev <T,N_FRAMES,1,K,0>
 
 template <typename T, int N_FRAMES>
 void Reorderer_static<T,N_FRAMES>
-::apply_rev(const T* in_data, std::vector<T*> out_data, const int data_length)
+::apply_rev(const T* in_data, const std::vector<T*> &out_data, const int data_length)
 {
 	if (out_data.size() != N_FRAMES)
 	{
@@ -379,12 +414,28 @@ void Reorderer_static<T,N_FRAMES>
 		throw length_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	Reorderer_static<T,N_FRAMES>::apply_rev(in_data, out_data.data(), data_length);
+}
+
+template <typename T, int N_FRAMES>
+void Reorderer_static<T,N_FRAMES>
+::apply_rev(const T* in_data, const std::array<T*,N_FRAMES> &out_data, const int data_length)
+{
+	Reorderer_static<T,N_FRAMES>::apply_rev(in_data, out_data.data(), data_length);
+}
+
+template <typename T, int N_FRAMES>
+void Reorderer_static<T,N_FRAMES>
+::apply_rev(const T* in_data, T* const* out_data, const int data_length)
+{
 	constexpr int n_fra   = N_FRAMES;
 	constexpr int n_fra_2 = N_FRAMES / 2;
 
-	int start_seq_loop = 0;
+	// specialized transposition (one frame per element of a register)
+	int start_seq_loop = frames_itranspose((const void*)in_data, reinterpret_cast<void* const*>(out_data), n_fra,
+	                                       data_length, (int)sizeof(T));
 
-	if (is_power_of_2((int)out_data.size()) && (int)out_data.size() >= 2 && (int)out_data.size() <= mipp::nElReg<T>())
+	if (start_seq_loop == 0 && is_power_of_2(n_fra) && n_fra >= 2 && n_fra <= mipp::nElReg<T>())
 	{
 		mipp::reg regs_inter[mipp::nElReg<T>()];
 
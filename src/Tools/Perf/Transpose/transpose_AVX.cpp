@@ -691,4 +691,131 @@ void aff3ct::tools::uchar_itranspose_avx(const __m256i *src, __m256i *dst, int n
 	}
 }
 
+// ============================================================================================ reordering of the frames
+
+namespace
+{
+struct unpack_epi8_avx
+{
+	static inline __m256i lo(const __m256i a, const __m256i b) { return _mm256_unpacklo_epi8(a, b); }
+	static inline __m256i hi(const __m256i a, const __m256i b) { return _mm256_unpackhi_epi8(a, b); }
+};
+
+struct unpack_epi16_avx
+{
+	static inline __m256i lo(const __m256i a, const __m256i b) { return _mm256_unpacklo_epi16(a, b); }
+	static inline __m256i hi(const __m256i a, const __m256i b) { return _mm256_unpackhi_epi16(a, b); }
+};
+
+struct unpack_epi32_avx
+{
+	static inline __m256i lo(const __m256i a, const __m256i b) { return _mm256_unpacklo_epi32(a, b); }
+	static inline __m256i hi(const __m256i a, const __m256i b) { return _mm256_unpackhi_epi32(a, b); }
+};
+
+// transposes the E x E matrices in the 128-bit lanes of the E registers 'r': log2(E) rounds of interleaving of the
+// registers i and i + E/2 ('U' interleaves the low and the high halves of the lanes)
+template <int E, class U>
+inline void transpose_lanes_avx(__m256i *r)
+{
+	__m256i t[E];
+	for (auto j = 1; j < E; j <<= 1)
+	{
+		for (auto i = 0; i < E / 2; i++)
+		{
+			t[2*i +0] = U::lo(r[i], r[E/2 +i]);
+			t[2*i +1] = U::hi(r[i], r[E/2 +i]);
+		}
+		for (auto i = 0; i < E; i++)
+			r[i] = t[i];
+	}
+}
+
+// transposes the 2E x 2E matrix of the 2E registers 'r' (the lanes of the registers 0..E-1 and E..2E-1 are transposed
+// first, then the 2 x 2 matrix of lanes)
+template <int E, class U>
+inline void transpose_avx(__m256i *r)
+{
+	transpose_lanes_avx<E,U>(r    );
+	transpose_lanes_avx<E,U>(r + E);
+
+	__m256i t[2 * E];
+	for (auto i = 0; i < E; i++)
+	{
+		t[    i] = _mm256_permute2x128_si256(r[i], r[E +i], 0x20);
+		t[E + i] = _mm256_permute2x128_si256(r[i], r[E +i], 0x31);
+	}
+	for (auto i = 0; i < 2 * E; i++)
+		r[i] = t[i];
+}
+
+template <int E, class U>
+inline void frames_transpose_avx(const void* const* src, void* dst, const int n)
+{
+	constexpr int n_frames = 2 * E; // = number of elements per register
+
+	__m256i r[n_frames];
+	auto p_dst = (__m256i*)dst;
+	for (auto b = 0; b < n / n_frames; b++)
+	{
+		for (auto f = 0; f < n_frames; f++)
+			r[f] = _mm256_loadu_si256((const __m256i*)src[f] + b);
+
+		transpose_avx<E,U>(r);
+
+		for (auto i = 0; i < n_frames; i++)
+			_mm256_storeu_si256(p_dst++, r[i]);
+	}
+}
+
+template <int E, class U>
+inline void frames_itranspose_avx(const void* src, void* const* dst, const int n)
+{
+	constexpr int n_frames = 2 * E; // = number of elements per register
+
+	__m256i r[n_frames];
+	auto p_src = (const __m256i*)src;
+	for (auto b = 0; b < n / n_frames; b++)
+	{
+		for (auto i = 0; i < n_frames; i++)
+			r[i] = _mm256_loadu_si256(p_src++);
+
+		transpose_avx<E,U>(r);
+
+		for (auto f = 0; f < n_frames; f++)
+			_mm256_storeu_si256((__m256i*)dst[f] + b, r[f]);
+	}
+}
+}
+
+void aff3ct::tools::frames_transpose_avx_8bit(const void* const* src, void* dst, int n)
+{
+	frames_transpose_avx<16,unpack_epi8_avx>(src, dst, n);
+}
+
+void aff3ct::tools::frames_transpose_avx_16bit(const void* const* src, void* dst, int n)
+{
+	frames_transpose_avx<8,unpack_epi16_avx>(src, dst, n);
+}
+
+void aff3ct::tools::frames_transpose_avx_32bit(const void* const* src, void* dst, int n)
+{
+	frames_transpose_avx<4,unpack_epi32_avx>(src, dst, n);
+}
+
+void aff3ct::tools::frames_itranspose_avx_8bit(const void* src, void* const* dst, int n)
+{
+	frames_itranspose_avx<16,unpack_epi8_avx>(src, dst, n);
+}
+
+void aff3ct::tools::frames_itranspose_avx_16bit(const void* src, void* const* dst, int n)
+{
+	frames_itranspose_avx<8,unpack_epi16_avx>(src, dst, n);
+}
+
+void aff3ct::tools::frames_itranspose_avx_32bit(const void* src, void* const* dst, int n)
+{
+	frames_itranspose_avx<4,unpack_epi32_avx>(src, dst, n);
+}
+
 #endif
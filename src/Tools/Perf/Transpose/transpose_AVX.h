@@ -16,6 +16,15 @@ void avx_itrans_float(float *A, float *B, int n);
 
 void uchar_transpose_avx(const __m256i *src, __m256i *dst, int n);
 void uchar_itranspose_avx(const __m256i *src, __m256i *dst, int n);
+
+// reordering of 32 frames of 8-bit elements, 16 frames of 16-bit elements or 8 frames of 32-bit elements ('n' is the
+// number of elements per frame, the last n % (number of frames) elements are not reordered)
+void frames_transpose_avx_8bit  (const void* const* src, void* dst, int n);
+void frames_transpose_avx_16bit (const void* const* src, void* dst, int n);
+void frames_transpose_avx_32bit (const void* const* src, void* dst, int n);
+void frames_itranspose_avx_8bit (const void* src, void* const* dst, int n);
+void frames_itranspose_avx_16bit(const void* src, void* const* dst, int n);
+void frames_itranspose_avx_32bit(const void* src, void* const* dst, int n);
 }
 }
 
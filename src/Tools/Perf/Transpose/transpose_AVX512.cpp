@@ -0,0 +1,137 @@
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+#include "transpose_AVX512.h"
+
+namespace
+{
+struct unpack_epi8_avx512
+{
+	static inline __m512i lo(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi8(a, b); }
+	static inline __m512i hi(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi8(a, b); }
+};
+
+struct unpack_epi16_avx512
+{
+	static inline __m512i lo(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi16(a, b); }
+	static inline __m512i hi(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi16(a, b); }
+};
+
+struct unpack_epi32_avx512
+{
+	static inline __m512i lo(const __m512i a, const __m512i b) { return _mm512_unpacklo_epi32(a, b); }
+	static inline __m512i hi(const __m512i a, const __m512i b) { return _mm512_unpackhi_epi32(a, b); }
+};
+
+// transposes the E x E matrices in the 128-bit lanes of the E registers 'r': log2(E) rounds of interleaving of the
+// registers i and i + E/2 ('U' interleaves the low and the high halves of the lanes)
+template <int E, class U>
+inline void transpose_lanes_avx512(__m512i *r)
+{
+	__m512i t[E];
+	for (auto j = 1; j < E; j <<= 1)
+	{
+		for (auto i = 0; i < E / 2; i++)
+		{
+			t[2*i +0] = U::lo(r[i], r[E/2 +i]);
+			t[2*i +1] = U::hi(r[i], r[E/2 +i]);
+		}
+		for (auto i = 0; i < E; i++)
+			r[i] = t[i];
+	}
+}
+
+// transposes the 4E x 4E matrix of the 4E registers 'r' (the lanes of the 4 groups of E registers are transposed
+// first, then the 4 x 4 matrix of lanes)
+template <int E, class U>
+inline void transpose_avx512(__m512i *r)
+{
+	for (auto g = 0; g < 4; g++)
+		transpose_lanes_avx512<E,U>(r + g * E);
+
+	__m512i t[4 * E];
+	for (auto i = 0; i < E; i++)
+	{
+		const auto l01_g01 = _mm512_shuffle_i64x2(r[0*E +i], r[1*E +i], 0x44); // lanes 0 and 1 of the groups 0 and 1
+		const auto l23_g01 = _mm512_shuffle_i64x2(r[0*E +i], r[1*E +i], 0xEE); // lanes 2 and 3 of the groups 0 and 1
+		const auto l01_g23 = _mm512_shuffle_i64x2(r[2*E +i], r[3*E +i], 0x44); // lanes 0 and 1 of the groups 2 and 3
+		const auto l23_g23 = _mm512_shuffle_i64x2(r[2*E +i], r[3*E +i], 0xEE); // lanes 2 and 3 of the groups 2 and 3
+
+		t[0*E +i] = _mm512_shuffle_i64x2(l01_g01, l01_g23, 0x88);
+		t[1*E +i] = _mm512_shuffle_i64x2(l01_g01, l01_g23, 0xDD);
+		t[2*E +i] = _mm512_shuffle_i64x2(l23_g01, l23_g23, 0x88);
+		t[3*E +i] = _mm512_shuffle_i64x2(l23_g01, l23_g23, 0xDD);
+	}
+	for (auto i = 0; i < 4 * E; i++)
+		r[i] = t[i];
+}
+
+template <int E, class U>
+inline void frames_transpose_avx512(const void* const* src, void* dst, const int n)
+{
+	constexpr int n_frames = 4 * E; // = number of elements per register
+
+	__m512i r[n_frames];
+	auto p_dst = (__m512i*)dst;
+	for (auto b = 0; b < n / n_frames; b++)
+	{
+		for (auto f = 0; f < n_frames; f++)
+			r[f] = _mm512_loadu_si512((const __m512i*)src[f] + b);
+
+		transpose_avx512<E,U>(r);
+
+		for (auto i = 0; i < n_frames; i++)
+			_mm512_storeu_si512(p_dst++, r[i]);
+	}
+}
+
+template <int E, class U>
+inline void frames_itranspose_avx512(const void* src, void* const* dst, const int n)
+{
+	constexpr int n_frames = 4 * E; // = number of elements per register
+
+	__m512i r[n_frames];
+	auto p_src = (const __m512i*)src;
+	for (auto b = 0; b < n / n_frames; b++)
+	{
+		for (auto i = 0; i < n_frames; i++)
+			r[i] = _mm512_loadu_si512(p_src++);
+
+		transpose_avx512<E,U>(r);
+
+		for (auto f = 0; f < n_frames; f++)
+			_mm512_storeu_si512((__m512i*)dst[f] + b, r[f]);
+	}
+}
+}
+
+void aff3ct::tools::frames_transpose_avx512_8bit(const void* const* src, void* dst, int n)
+{
+	frames_transpose_avx512<16,unpack_epi8_avx512>(src, dst, n);
+}
+
+void aff3ct::tools::frames_transpose_avx512_16bit(const void* const* src, void* dst, int n)
+{
+	frames_transpose_avx512<8,unpack_epi16_avx512>(src, dst, n);
+}
+
+void aff3ct::tools::frames_transpose_avx512_32bit(const void* const* src, void* dst, int n)
+{
+	frames_transpose_avx512<4,unpack_epi32_avx512>(src, dst, n);
+}
+
+void aff3ct::tools::frames_itranspose_avx512_8bit(const void* src, void* const* dst, int n)
+{
+	frames_itranspose_avx512<16,unpack_epi8_avx512>(src, dst, n);
+}
+
+void aff3ct::tools::frames_itranspose_avx512_16bit(const void* src, void* const* dst, int n)
+{
+	frames_itranspose_avx512<8,unpack_epi16_avx512>(src, dst, n);
+}
+
+void aff3ct::tools::frames_itranspose_avx512_32bit(const void* src, void* const* dst, int n)
+{
+	frames_itranspose_avx512<4,unpack_epi32_avx512>(src, dst, n);
+}
+
+#endif
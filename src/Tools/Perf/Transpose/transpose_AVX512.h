@@ -0,0 +1,25 @@
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+
+#ifndef TRANSPOSE_AVX512_H
+#define	TRANSPOSE_AVX512_H
+
+#include <immintrin.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+// reordering of 64 frames of 8-bit elements, 32 frames of 16-bit elements or 16 frames of 32-bit elements ('n' is the
+// number of elements per frame, the last n % (number of frames) elements are not reordered)
+void frames_transpose_avx512_8bit  (const void* const* src, void* dst, int n);
+void frames_transpose_avx512_16bit (const void* const* src, void* dst, int n);
+void frames_transpose_avx512_32bit (const void* const* src, void* dst, int n);
+void frames_itranspose_avx512_8bit (const void* src, void* const* dst, int n);
+void frames_itranspose_avx512_16bit(const void* src, void* const* dst, int n);
+void frames_itranspose_avx512_32bit(const void* src, void* const* dst, int n);
+}
+}
+
+#endif	/* TRANSPOSE_AVX512_H */
+
+#endif
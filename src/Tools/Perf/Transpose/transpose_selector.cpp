@@ -10,6 +10,9 @@
 #if defined(__ARM_NEON__) || defined(__ARM_NEON)
 #include "transpose_NEON.h"
 #endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+#include "transpose_AVX512.h"
+#endif
 
 #include "transpose_selector.h"
 
@@ -74,3 +77,59 @@ bool aff3ct::tools::char_itranspose(const signed char *src, signed char *dst, in
 
 	return is_itransposed;
 }
+
+int aff3ct::tools::frames_transpose(const void* const* src, void* dst, int n_frames, int n, int size)
+{
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+	if (n_frames * size == 64)
+	{
+		     if (size == 1) frames_transpose_avx512_8bit (src, dst, n);
+		else if (size == 2) frames_transpose_avx512_16bit(src, dst, n);
+		else if (size == 4) frames_transpose_avx512_32bit(src, dst, n);
+		else return 0;
+
+		return n - n % n_frames;
+	}
+#endif
+#if defined(__AVX2__)
+	if (n_frames * size == 32)
+	{
+		     if (size == 1) frames_transpose_avx_8bit (src, dst, n);
+		else if (size == 2) frames_transpose_avx_16bit(src, dst, n);
+		else if (size == 4) frames_transpose_avx_32bit(src, dst, n);
+		else return 0;
+
+		return n - n % n_frames;
+	}
+#endif
+
+	return 0;
+}
+
+int aff3ct::tools::frames_itranspose(const void* src, void* const* dst, int n_frames, int n, int size)
+{
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+	if (n_frames * size == 64)
+	{
+		     if (size == 1) frames_itranspose_avx512_8bit (src, dst, n);
+		else if (size == 2) frames_itranspose_avx512_16bit(src, dst, n);
+		else if (size == 4) frames_itranspose_avx512_32bit(src, dst, n);
+		else return 0;
+
+		return n - n % n_frames;
+	}
+#endif
+#if defined(__AVX2__)
+	if (n_frames * size == 32)
+	{
+		     if (size == 1) frames_itranspose_avx_8bit (src, dst, n);
+		else if (size == 2) frames_itranspose_avx_16bit(src, dst, n);
+		else if (size == 4) frames_itranspose_avx_32bit(src, dst, n);
+		else return 0;
+
+		return n - n % n_frames;
+	}
+#endif
+
+	return 0;
+}
@@ -7,6 +7,12 @@ namespace tools
 {
 bool char_transpose (const signed char *src, signed char *dst, int n);
 bool char_itranspose(const signed char *src, signed char *dst, int n);
+
+// reorders 'n_frames' frames of 'n' elements of 'size' bytes (| e0_f0 | e0_f1 | ... | e1_f0 | ...) when a specialized
+// transposition fits (AVX2 or AVX-512, one frame per element of a register), returns the number of elements per frame
+// which are reordered (the remaining ones are left to the caller)
+int frames_transpose (const void* const* src, void* dst, int n_frames, int n, int size);
+int frames_itranspose(const void* src, void* const* dst, int n_frames, int n, int size);
 }
 }
 
@@ -0,0 +1,48 @@
+#include <thread>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Spin_barrier.hpp"
+
+using namespace aff3ct::tools;
+
+Spin_barrier
+::Spin_barrier(const int n_threads)
+: n_threads(n_threads), counter_barrier(n_threads), generation(0)
+{
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+Spin_barrier
+::~Spin_barrier()
+{
+}
+
+void Spin_barrier
+::operator()(const int tid)
+{
+	const auto cur_gen = generation.load(std::memory_order_acquire);
+
+	if (counter_barrier.fetch_sub(1, std::memory_order_acq_rel) == 1)
+	{
+		counter_barrier.store(n_threads, std::memory_order_relaxed);
+		generation.fetch_add(1, std::memory_order_release);
+	}
+	else
+	{
+		// give the core to the other threads after a while (when there are more threads than cores)
+		auto n_spins = 0;
+		while (generation.load(std::memory_order_acquire) == cur_gen)
+			if (++n_spins >= 1024)
+			{
+				n_spins = 0;
+				std::this_thread::yield();
+			}
+	}
+}
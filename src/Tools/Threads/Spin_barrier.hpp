@@ -0,0 +1,56 @@
+/*!
+ * \file
+ * \brief Waits until all threads reach the barrier (active waiting).
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef SPIN_BARRIER_HPP
+#define SPIN_BARRIER_HPP
+
+#include <atomic>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Spin_barrier
+ *
+ * \brief Waits until all threads reach the barrier (active waiting).
+ *
+ * The threads spin on an atomic counter instead of sleeping on a condition variable: the synchronization costs much
+ * less than with the Barrier class when the threads reach the barrier at short intervals (many times per frame), but
+ * the waiting threads keep their cores busy.
+ */
+class Spin_barrier
+{
+private:
+	const int n_threads;
+	std::atomic<int> counter_barrier;
+	std::atomic<int> generation;
+
+public:
+	/*!
+	 * \brief Constructor.
+	 *
+	 * \param n_threads: number of threads to wait in the barrier.
+	 */
+	Spin_barrier(const int n_threads);
+
+	/*!
+	 * \brief Destructor.
+	 */
+	~Spin_barrier();
+
+	/*!
+	 * \brief Blocking method, wait until "n_threads" threads call this method.
+	 *
+	 * \param tid: the number id of the thread which call this method.
+	 */
+	void operator()(const int tid = -1);
+};
+}
+}
+
+#endif /* SPIN_BARRIER_HPP */
@@ -43,6 +43,7 @@ struct code_parameters
 	std::string type;
 	std::string fb_gen_method;
 	std::string alist_path;
+	std::string bin_path;
 	std::string awgn_fb_path;
 	float       sigma; // not noise var, used to set a fixed snr value for frozen bits construction (in polar codes)
 	float       R;     // code rate
@@ -76,6 +77,7 @@ struct encoder_parameters
 {
 	std::string      type;
 	std::string      path;
+	std::string      cache_path; // directory of the cached generator matrices (LDPC codes)
 	bool             systematic;
 	bool             buffered;
 	std::vector<int> poly;
@@ -124,6 +126,9 @@ struct channel_parameters
 	std::string type;
 	std::string path;
 	std::string block_fading;
+	float       doppler;     // normalized Doppler frequency (f_d * T_s) of the time-correlated fading
+	int         n_sin;       // number of sinusoids used to generate the time-correlated fading
+	float       probability; // flip (BSC) or erasure (BEC) probability, Q(1 / sigma) when negative
 };
 
 struct quantizer_parameters
@@ -144,6 +149,7 @@ struct decoder_parameters
 	std::string gen_path;
 	std::string polar_nodes;
 	bool        enable_syndrome;
+	bool        reorder;
 	bool        full_adaptive;
 	float       normalize_factor;
 	float       offset;
@@ -156,6 +162,12 @@ struct decoder_parameters
 	int         fnc_ite_max;
 	int         fnc_ite_step;
 	int         syndrome_depth;
+	int         n_bits_msg;
+	int         n_bits_app;
+	int         group_size;
+	bool        compress;
+	int         n_threads;
+	bool        stream;
 };
 
 struct monitor_parameters
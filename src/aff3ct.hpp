@@ -16,7 +16,9 @@
 #include <Tools/Code/Polar/API/functions_polar_intra_32bit.h>
 #include <Tools/Code/Polar/decoder_polar_functions.h>
 #include <Tools/Code/Polar/fb_extract.h>
+#include <Tools/Code/LDPC/decoder_LDPC_functions.h>
 #include <Tools/Perf/Transpose/transpose_AVX.h>
+#include <Tools/Perf/Transpose/transpose_AVX512.h>
 #include <Tools/Perf/Transpose/transpose_SSE.h>
 #include <Tools/Perf/Transpose/transpose_selector.h>
 #include <Tools/Perf/Transpose/transpose_NEON.h>
@@ -28,6 +30,7 @@
 //find ./src/ -type f -follow -print | grep "[.]hpp$"
 #include <Tools/Exception/exception.hpp>
 #include <Tools/Threads/Barrier.hpp>
+#include <Tools/Threads/Spin_barrier.hpp>
 #include <Tools/Math/Galois.hpp>
 #include <Tools/Factory/Factory_monitor.hpp>
 #include <Tools/Factory/Polar/Factory_decoder_polar_gen.hpp>
@@ -74,6 +77,8 @@
 #include <Tools/Algo/Noise/GSL/Noise_GSL.hpp>
 #include <Tools/Algo/Predicate_ite.hpp>
 #include <Tools/Algo/Bit_packer.hpp>
+#include <Tools/Algo/Bucket_queue/Bucket_queue.hpp>
+#include <Tools/Algo/Binary_file/Binary_file.hpp>
 #include <Tools/SystemC/SC_Router.hpp>
 #include <Tools/SystemC/SC_Dummy.hpp>
 #include <Tools/SystemC/SC_Predicate.hpp>
@@ -119,6 +124,12 @@
 #include <Tools/Code/Polar/Pattern_polar_parser.hpp>
 #include <Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp>
 #include <Tools/Code/LDPC/AList/AList.hpp>
+#include <Tools/Code/LDPC/G_cache/LDPC_G_cache.hpp>
+#include <Tools/Code/LDPC/G_packed/LDPC_G_packed.hpp>
+#include <Tools/Code/LDPC/RU/LDPC_RU_form.hpp>
+#include <Tools/Code/LDPC/QC/LDPC_QC.hpp>
+#include <Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp>
+#include <Tools/Code/LDPC/H_binary/LDPC_H_binary.hpp>
 #include <Tools/Code/SCMA/modem_SCMA_functions.hpp>
 #include <Tools/Code/Turbo/Post_processing_SISO/Post_processing_SISO.hpp>
 #include <Tools/Code/Turbo/Post_processing_SISO/Self_corrected/Self_corrected.hpp>
@@ -186,12 +197,14 @@
 #include <Module/Encoder/RSC/Encoder_RSC_generic_json_sys.hpp>
 #include <Module/Encoder/RSC/Encoder_RSC_sys.hpp>
 #include <Module/Encoder/RSC/Encoder_RSC_generic_sys.hpp>
+#include <Module/Encoder/RSC/Encoder_RSC_table_sys.hpp>
 #include <Module/Encoder/RSC/Encoder_RSC3_CPE_sys.hpp>
 // #include <Module/Encoder/SC_Encoder.hpp>
 // #include <Module/Encoder/SPU_Encoder.hpp>
 #include <Module/Encoder/Repetition/Encoder_repetition_sys.hpp>
 #include <Module/Encoder/LDPC/Encoder_LDPC.hpp>
 #include <Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp>
+#include <Module/Encoder/LDPC/RU/Encoder_LDPC_RU.hpp>
 #include <Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2.hpp>
 #include <Module/Encoder/LDPC/DVBS2/Encoder_LDPC_DVBS2_constants.hpp>
 #include <Module/Encoder/Coset/Encoder_coset.hpp>
@@ -207,8 +220,12 @@
 // #include <Module/Channel/SPU_Channel.hpp>
 #include <Module/Channel/User/Channel_user.hpp>
 #include <Module/Channel/Rayleigh/Channel_Rayleigh_LLR.hpp>
+#include <Module/Channel/Rayleigh/Channel_Rayleigh_LLR_Jakes.hpp>
 // #include <Module/Channel/SC_Channel.hpp>
 #include <Module/Channel/NO/Channel_NO.hpp>
+#include <Module/Channel/Binary/Channel_binary.hpp>
+#include <Module/Channel/Binary/Channel_BSC.hpp>
+#include <Module/Channel/Binary/Channel_BEC.hpp>
 #include <Module/Decoder/Decoder.hpp>
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp>
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp>
@@ -379,14 +396,27 @@
 // #include <Module/Decoder/SC_SISO.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_offset_normalize_min_sum.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_inter.hpp>
+#include <Module/Decoder/LDPC/BP/Layered/ONMS/Decoder_LDPC_BP_layered_ONMS_intra.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/LSPA/Decoder_LDPC_BP_layered_log_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/SPA/Decoder_LDPC_BP_layered_sum_product.hpp>
 #include <Module/Decoder/LDPC/BP/Layered/Decoder_LDPC_BP_layered.hpp>
+#include <Module/Decoder/LDPC/BP/Shuffled/ONMS/Decoder_LDPC_BP_shuffled_offset_normalize_min_sum.hpp>
+#include <Module/Decoder/LDPC/BP/Shuffled/LSPA/Decoder_LDPC_BP_shuffled_log_sum_product.hpp>
+#include <Module/Decoder/LDPC/BP/Shuffled/SPA/Decoder_LDPC_BP_shuffled_sum_product.hpp>
+#include <Module/Decoder/LDPC/BP/Shuffled/Decoder_LDPC_BP_shuffled.hpp>
+#include <Module/Decoder/LDPC/BP/Residual/ONMS/Decoder_LDPC_BP_residual_offset_normalize_min_sum.hpp>
+#include <Module/Decoder/LDPC/BP/Residual/SPA/Decoder_LDPC_BP_residual_sum_product.hpp>
+#include <Module/Decoder/LDPC/BP/Residual/Decoder_LDPC_BP_residual.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_GALA_inter.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_offset_normalize_min_sum.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/ONMS/Decoder_LDPC_BP_flooding_ONMS_inter.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_log_sum_product.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/LSPA/Decoder_LDPC_BP_flooding_LSPA_inter.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_sum_product.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA_inter.hpp>
 #include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp>
+#include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_inter.hpp>
 #include <Module/Decoder/BCH/Decoder_BCH.hpp>
 #include <Module/Decoder/Decoder_SISO.hpp>
 #include <Module/Decoder/NO/Decoder_NO.hpp>